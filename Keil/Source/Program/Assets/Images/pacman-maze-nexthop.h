@@ -0,0 +1,1205 @@
+// This table was auto-generated by maze2nexthop.py. Do not edit it manually.
+#ifndef __PACMAN_BASEMAZE_NEXTHOP_H
+#define __PACMAN_BASEMAZE_NEXTHOP_H
+
+#include "pacman_types.h"
+
+// Cells reachable by the ghosts: 272. Flash needed by the tables: 19646 bytes.
+#define PACMAN_BASEMAZE_HAS_NEXTHOP 1
+#define PACMAN_BASEMAZE_NEXTHOP_CELLS 272
+
+// clang-format off
+
+// Dense index of each cell reachable by the ghosts, PM_NEXTHOP_NO_CELL for the others.
+const u16 PACMAN_BaseMazeCellIndex[25][23] = {
+    {PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL},
+    {PM_NEXTHOP_NO_CELL, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, PM_NEXTHOP_NO_CELL, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, PM_NEXTHOP_NO_CELL},
+    {PM_NEXTHOP_NO_CELL, 20, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, 21, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, 22, PM_NEXTHOP_NO_CELL, 23, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, 24, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, 25, PM_NEXTHOP_NO_CELL},
+    {PM_NEXTHOP_NO_CELL, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, PM_NEXTHOP_NO_CELL},
+    {PM_NEXTHOP_NO_CELL, 47, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, 48, PM_NEXTHOP_NO_CELL, 49, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, 50, PM_NEXTHOP_NO_CELL, 51, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, 52, PM_NEXTHOP_NO_CELL},
+    {PM_NEXTHOP_NO_CELL, 53, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, 54, 55, 56, PM_NEXTHOP_NO_CELL, 57, 58, 59, PM_NEXTHOP_NO_CELL, 60, 61, 62, PM_NEXTHOP_NO_CELL, 63, 64, 65, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, 66, PM_NEXTHOP_NO_CELL},
+    {PM_NEXTHOP_NO_CELL, 67, 68, 69, 70, PM_NEXTHOP_NO_CELL, 71, 72, 73, 74, 75, PM_NEXTHOP_NO_CELL, 76, 77, 78, 79, 80, PM_NEXTHOP_NO_CELL, 81, 82, 83, 84, PM_NEXTHOP_NO_CELL},
+    {PM_NEXTHOP_NO_CELL, 85, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, 86, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, 87, PM_NEXTHOP_NO_CELL, 88, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, 89, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, 90, PM_NEXTHOP_NO_CELL},
+    {PM_NEXTHOP_NO_CELL, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, PM_NEXTHOP_NO_CELL},
+    {PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, 112, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, 113, PM_NEXTHOP_NO_CELL, 114, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, 115, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL},
+    {PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, 116, PM_NEXTHOP_NO_CELL, 117, 118, 119, 120, 121, 122, 123, PM_NEXTHOP_NO_CELL, 124, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL},
+    {PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, 125, PM_NEXTHOP_NO_CELL, 126, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, 127, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, 128, PM_NEXTHOP_NO_CELL, 129, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL},
+    {PM_NEXTHOP_NO_CELL, 130, 131, 132, 133, 134, 135, 136, 137, PM_NEXTHOP_NO_CELL, 138, 139, 140, PM_NEXTHOP_NO_CELL, 141, 142, 143, 144, 145, 146, 147, 148, PM_NEXTHOP_NO_CELL},
+    {PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, 149, PM_NEXTHOP_NO_CELL, 150, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, 151, PM_NEXTHOP_NO_CELL, 152, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL},
+    {PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, 153, PM_NEXTHOP_NO_CELL, 154, 155, 156, 157, 158, 159, 160, PM_NEXTHOP_NO_CELL, 161, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL},
+    {PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, 162, PM_NEXTHOP_NO_CELL, 163, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, 164, PM_NEXTHOP_NO_CELL, 165, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL},
+    {PM_NEXTHOP_NO_CELL, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, PM_NEXTHOP_NO_CELL},
+    {PM_NEXTHOP_NO_CELL, 187, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, 188, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, 189, PM_NEXTHOP_NO_CELL, 190, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, 191, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, 192, PM_NEXTHOP_NO_CELL},
+    {PM_NEXTHOP_NO_CELL, 193, PM_NEXTHOP_NO_CELL, 194, 195, 196, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, 197, PM_NEXTHOP_NO_CELL, 198, 199, 200, 201, PM_NEXTHOP_NO_CELL, 202, PM_NEXTHOP_NO_CELL, 203, 204, 205, PM_NEXTHOP_NO_CELL},
+    {PM_NEXTHOP_NO_CELL, 206, PM_NEXTHOP_NO_CELL, 207, 208, 209, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, 210, PM_NEXTHOP_NO_CELL, 211, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, 212, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, 213, PM_NEXTHOP_NO_CELL},
+    {PM_NEXTHOP_NO_CELL, 214, PM_NEXTHOP_NO_CELL, 215, 216, 217, PM_NEXTHOP_NO_CELL, 218, 219, PM_NEXTHOP_NO_CELL, 220, PM_NEXTHOP_NO_CELL, 221, PM_NEXTHOP_NO_CELL, 222, 223, 224, 225, 226, 227, PM_NEXTHOP_NO_CELL, 228, PM_NEXTHOP_NO_CELL},
+    {PM_NEXTHOP_NO_CELL, 229, PM_NEXTHOP_NO_CELL, 230, 231, 232, PM_NEXTHOP_NO_CELL, 233, 234, PM_NEXTHOP_NO_CELL, 235, PM_NEXTHOP_NO_CELL, 236, PM_NEXTHOP_NO_CELL, 237, 238, 239, 240, 241, 242, PM_NEXTHOP_NO_CELL, 243, PM_NEXTHOP_NO_CELL},
+    {PM_NEXTHOP_NO_CELL, 244, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, 245, PM_NEXTHOP_NO_CELL, 246, 247, PM_NEXTHOP_NO_CELL, 248, PM_NEXTHOP_NO_CELL, 249, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, 250, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, 251, PM_NEXTHOP_NO_CELL},
+    {PM_NEXTHOP_NO_CELL, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, PM_NEXTHOP_NO_CELL, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, PM_NEXTHOP_NO_CELL},
+    {PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL, PM_NEXTHOP_NO_CELL},
+};
+
+// Entry (from * 272 + to), 2 bits each: the direction of the first step from -> to,
+// as an offset from PM_MOV_UP. Four entries per byte, starting from the least significant bits.
+const u8 PACMAN_BaseMazeNextHop[18496] = {
+    0xFC, 0xFF, 0x5F, 0x55, 0x55, 0x7D, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xAF, 0xEA, 0xFF, 0xFF, 0xFF, 0xBF,
+    0xFF, 0xEB, 0xFF, 0xFF, 0xBF, 0xEA, 0xFF, 0xFF, 0xFF, 0xFB, 0xBF, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xAF, 0xFA,
+    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xBF, 0xEA, 0xFF, 0xFF, 0xFF, 0xFB, 0xBF, 0xEA,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFE, 0xAF, 0xFE, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xBF, 0xFA, 0xFF, 0xFF,
+    0xFF, 0xFB, 0xBF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xAA, 0xFC, 0xFF, 0xFF, 0xFF, 0xFE, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF,
+    0xBF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFB, 0xBF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xF2, 0x5F, 0x55, 0x55, 0x76, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xCA, 0xFF, 0xFF, 0xFF, 0xFA, 0xAF, 0xAA,
+    0xEA, 0xFF, 0xFF, 0xBF, 0xFA, 0xAB, 0xAA, 0xFF, 0xBF, 0xAA, 0xAA, 0xFF, 0xFF, 0xAB, 0xBE, 0xAA,
+    0xAA, 0xAA, 0xFA, 0xFF, 0xEA, 0xAA, 0xAA, 0xAB, 0xAE, 0xAA, 0xAA, 0xEA, 0xFF, 0xAB, 0xAB, 0xAA,
+    0xAE, 0xAE, 0xAA, 0xAA, 0xAA, 0xFE, 0xBF, 0xEA, 0xAB, 0xAA, 0xFA, 0xAF, 0xAA, 0xAF, 0xAA, 0xFA,
+    0xFF, 0xAB, 0xAA, 0xFE, 0xFF, 0xAA, 0xFA, 0xAA, 0xAA, 0xAA, 0xEA, 0xFF, 0xAA, 0x2A, 0xFF, 0xFF,
+    0xFF, 0xFA, 0xAF, 0xAA, 0xFA, 0xFF, 0xFF, 0xBF, 0xFA, 0xAB, 0xAA, 0xFF, 0xBF, 0xAA, 0xAA, 0xFF,
+    0xFF, 0xAB, 0xBF, 0xAA, 0xAA, 0xAA, 0xFE, 0xFF, 0xEA, 0xAA, 0xAA, 0xAB, 0xAE, 0xAA, 0xAA, 0xFA,
+    0xFF, 0xAB, 0xAB, 0xAA, 0xAE, 0xAE, 0xAA, 0xAA, 0xAA, 0xFF, 0xBF, 0xEA, 0xAB, 0xAA, 0xFA, 0xAF,
+    0xAA, 0xAF, 0xAA, 0xFA, 0xFF, 0xAB, 0xAA, 0xFE, 0xFF, 0xAA, 0xFA, 0xAA, 0xAA, 0xAA, 0xFA, 0xFF,
+    0xAA, 0xAA, 0xFC, 0xFF, 0xFF, 0xFA, 0xAF, 0xAA, 0xFE, 0xFF, 0xFF, 0xBF, 0xFE, 0xAB, 0xFE, 0xFF,
+    0xBF, 0xAA, 0xFE, 0xFF, 0xFF, 0xEB, 0xBF, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xEB,
+    0xAF, 0xAA, 0xFA, 0xFF, 0xFF, 0xEB, 0xAB, 0xAA, 0xAF, 0xAF, 0xAA, 0xAA, 0xEA, 0xFF, 0xBF, 0xEA,
+    0xAB, 0xAA, 0xFA, 0xAF, 0xAA, 0xAF, 0xAA, 0xFA, 0xFF, 0xAB, 0xAA, 0xFE, 0xFF, 0xAA, 0xFA, 0xAA,
+    0xAA, 0xAA, 0xFE, 0xFF, 0xAA, 0xAA, 0x52, 0x55, 0x55, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xC5, 0xFF, 0xFF, 0x55, 0x5F, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0x2A, 0xFF,
+    0xFF, 0xAA, 0xAF, 0xAA, 0xAA, 0xAA, 0xFE, 0xBF, 0xEA, 0xAB, 0xAA, 0xEA, 0xBF, 0xAA, 0xAA, 0xAA,
+    0xFF, 0xAB, 0xBE, 0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA, 0xAB, 0xAE, 0xAA, 0xAA, 0xFE,
+    0xFF, 0xEB, 0xAB, 0xFF, 0xAF, 0xAF, 0xAA, 0xEA, 0xFF, 0xFF, 0xBF, 0xFE, 0xAB, 0xFE, 0xFF, 0xAF,
+    0xFA, 0xAF, 0xAA, 0xFF, 0xFF, 0xAB, 0xEA, 0xFF, 0xFF, 0xAA, 0xFF, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF,
+    0xAA, 0xAA, 0xAA, 0xFC, 0xFF, 0xAA, 0xAF, 0xAA, 0xAA, 0xAA, 0xFF, 0xBF, 0xEA, 0xAB, 0xAA, 0xEA,
+    0xBF, 0xAA, 0xAA, 0xEA, 0xFF, 0xAB, 0xBE, 0xAA, 0xAA, 0xEA, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA, 0xAB,
+    0xAF, 0xAA, 0xAA, 0xFE, 0xFF, 0xEB, 0xEB, 0xFF, 0xAF, 0xAF, 0xAA, 0xFA, 0xFF, 0xFF, 0xBF, 0xFE,
+    0xAB, 0xFE, 0xFF, 0xAF, 0xFA, 0xAF, 0xEA, 0xFF, 0xFF, 0xAB, 0xFA, 0xFF, 0xFF, 0xEA, 0xFF, 0xAA,
+    0xEA, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xF2, 0xFF, 0xAA, 0xAF, 0xAA, 0xAA, 0xEA, 0xFF, 0xBF,
+    0xFA, 0xAB, 0xAA, 0xFF, 0xBF, 0xAA, 0xAA, 0xFF, 0xFF, 0xAB, 0xBF, 0xAA, 0xFA, 0xFF, 0xFF, 0xFF,
+    0xFE, 0xFE, 0xFF, 0xFB, 0xAF, 0xAA, 0xFE, 0xFF, 0xFF, 0xFB, 0xFB, 0xFF, 0xEF, 0xAF, 0xAA, 0xFE,
+    0xFF, 0xFF, 0xBF, 0xFE, 0xAB, 0xFE, 0xFF, 0xAF, 0xFA, 0xAF, 0xFA, 0xFF, 0xFF, 0xAB, 0xFE, 0xFF,
+    0xFF, 0xFA, 0xFF, 0xAA, 0xFA, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0xA5, 0xCA, 0xFF, 0x95, 0x5D, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0x2A,
+    0xFF, 0xAA, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0xBA, 0xAA, 0xAB, 0xAA, 0xAA, 0xBA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAB, 0xBA, 0xAA, 0xAA, 0xAA, 0xAA, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0xAA, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0xBE, 0xAA, 0xAB, 0xAA, 0xAA,
+    0xBA, 0xAA, 0xAA, 0xAA, 0xEA, 0xAB, 0xBA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xF2, 0xAA, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0xBF,
+    0xAA, 0xAB, 0xAA, 0xAA, 0xBA, 0xAA, 0xAA, 0xAA, 0xFA, 0xAB, 0xBA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFE,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xCA, 0xAA, 0xAE, 0xAA,
+    0xAA, 0xAA, 0xEA, 0xBF, 0xAA, 0xAB, 0xAA, 0xAA, 0xBA, 0xAA, 0xAA, 0xAA, 0xFE, 0xAB, 0xBA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xFF, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0xA5, 0xAA,
+    0x2A, 0x95, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x00, 0x00, 0x50, 0x55, 0x55, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x50, 0x55, 0x55, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x50, 0x55, 0x55, 0x40, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00,
+    0x00, 0x15, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x05, 0x00, 0x00, 0x15, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x00, 0x15, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFC, 0xCF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0x57, 0xFF, 0xFF, 0x7F, 0xD5, 0xFF, 0xFD, 0xFF, 0xF7, 0x7D, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xFE, 0xFF, 0xFF,
+    0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xEB, 0xFF, 0xFF, 0xBF, 0xEA, 0xFF, 0xFF,
+    0xFF, 0xFB, 0xBF, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xAF, 0xFC, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF,
+    0xBF, 0xEA, 0xFF, 0xFF, 0xFF, 0xFB, 0xBF, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xAF, 0xF2, 0xFF, 0xFF, 0xFF, 0xBF,
+    0xFF, 0xFB, 0xFF, 0xFF, 0xBF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFB, 0xBF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xAF, 0xCA,
+    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xBF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFB, 0xBF, 0xFE,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xF0, 0xFF,
+    0xFF, 0xF2, 0xAF, 0x2A, 0xFF, 0xFF, 0xFF, 0xBF, 0xFD, 0x5B, 0xFD, 0xFF, 0x7F, 0x55, 0x55, 0xFD,
+    0xFF, 0x57, 0x7D, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0xAA, 0xAA, 0xFE, 0xFF, 0xFF, 0xFA, 0xAF, 0xAA, 0xFC, 0xFF, 0xFF, 0xBF, 0xFE, 0xAB, 0xFE, 0xFF,
+    0xBF, 0xAA, 0xFE, 0xFF, 0xFF, 0xEB, 0xBF, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xEB,
+    0xAF, 0xAA, 0xFA, 0xFF, 0xFF, 0xEB, 0xAB, 0xAA, 0xAF, 0xAF, 0xAA, 0xAA, 0xEA, 0xFF, 0xBF, 0xEA,
+    0xAB, 0xAA, 0xFA, 0xAF, 0xAA, 0xAF, 0xAA, 0xFA, 0xFF, 0xAB, 0xAA, 0xFE, 0xFF, 0xAA, 0xFA, 0xAA,
+    0xAA, 0xAA, 0xEA, 0xFF, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0xFA, 0xAF, 0xAA, 0xF2, 0xFF, 0xFF, 0xBF,
+    0xF6, 0xAB, 0x56, 0xFF, 0xBF, 0x6A, 0x55, 0xFD, 0xFF, 0x5B, 0x7D, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xEA, 0xFF, 0xFF, 0xFF, 0xFA, 0xAF, 0xAA,
+    0xCA, 0xFF, 0xFF, 0xBF, 0xFA, 0xAB, 0xAA, 0xFF, 0xBF, 0xAA, 0xAA, 0xFF, 0xFF, 0xAB, 0xBE, 0xAA,
+    0xAA, 0xAA, 0xFA, 0xFF, 0xEA, 0xAA, 0xAA, 0xAB, 0xAE, 0xAA, 0xAA, 0xEA, 0xFF, 0xAB, 0xAB, 0xAA,
+    0xAE, 0xAE, 0xAA, 0xAA, 0xAA, 0xFE, 0xBF, 0xEA, 0xAB, 0xAA, 0xFA, 0xAF, 0xAA, 0xAF, 0xAA, 0xFA,
+    0xFF, 0xAB, 0xAA, 0xFE, 0xFF, 0xAA, 0xFA, 0xAA, 0xAA, 0xAA, 0xFE, 0xFF, 0x00, 0x00, 0xF0, 0xFF,
+    0xFF, 0xCA, 0xAF, 0xAA, 0x2A, 0xFF, 0xFF, 0xBF, 0xFA, 0xAB, 0xAA, 0xFF, 0xBF, 0xAA, 0xAA, 0xFF,
+    0xFF, 0xAB, 0xBF, 0xAA, 0xAA, 0xAA, 0xFE, 0xFF, 0xEA, 0xAA, 0xAA, 0xAB, 0xAE, 0xAA, 0xAA, 0xFA,
+    0xFF, 0xAB, 0xAB, 0xAA, 0xAE, 0xAE, 0xAA, 0xAA, 0xAA, 0xFF, 0xBF, 0xEA, 0xAB, 0xAA, 0xFA, 0xAF,
+    0xAA, 0xAF, 0xAA, 0xFA, 0xFF, 0xAB, 0xAA, 0xFE, 0xFF, 0xAA, 0xFA, 0xAA, 0xAA, 0xAA, 0xFF, 0xFF,
+    0xAA, 0xAA, 0xFA, 0xFF, 0xFF, 0xEA, 0xAF, 0xAA, 0xAA, 0xFC, 0xFF, 0xBF, 0xFA, 0xAB, 0xAA, 0xFF,
+    0xBF, 0xAA, 0xAA, 0xFF, 0xFF, 0xAB, 0xBF, 0xAA, 0xAA, 0xFA, 0xFF, 0xFF, 0xFA, 0xAA, 0xFE, 0xAB,
+    0xAF, 0xAA, 0xAA, 0xFE, 0xFF, 0xEB, 0xAB, 0xFA, 0xAF, 0xAF, 0xAA, 0xAA, 0xFE, 0xFF, 0xBF, 0xFA,
+    0xAB, 0xFA, 0xFF, 0xAF, 0xEA, 0xAF, 0xAA, 0xFE, 0xFF, 0xAB, 0xAA, 0xFF, 0xFF, 0xAA, 0xFE, 0xAA,
+    0xAA, 0xFA, 0xFF, 0xFF, 0xAA, 0xAA, 0x0A, 0x00, 0x00, 0x2A, 0xAF, 0xAA, 0xAA, 0xF2, 0xFF, 0xBF,
+    0xFA, 0xAB, 0xAA, 0xFF, 0xBF, 0xAA, 0xAA, 0xFF, 0xFF, 0xAB, 0xBF, 0xAA, 0xAA, 0xFE, 0xFF, 0xFF,
+    0xFA, 0xAA, 0xFF, 0xEB, 0xAF, 0xAA, 0xFA, 0xFF, 0xFF, 0xEB, 0xAB, 0xFE, 0xAF, 0xAF, 0xAA, 0xAA,
+    0xFF, 0xFF, 0xBF, 0xFA, 0xAB, 0xFA, 0xFF, 0xAF, 0xEA, 0xAF, 0xAA, 0xFE, 0xFF, 0xAB, 0xAA, 0xFF,
+    0xFF, 0xAA, 0xFE, 0xAA, 0xAA, 0xFA, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xFA, 0xFF, 0xAA, 0xAF, 0xAA,
+    0xAA, 0xCA, 0xFF, 0xBF, 0xFA, 0xAB, 0xAA, 0xFF, 0xBF, 0xAA, 0xAA, 0xFF, 0xFF, 0xAB, 0xBF, 0xAA,
+    0xFA, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFB, 0xAF, 0xAA, 0xFE, 0xFF, 0xFF, 0xFB, 0xFB, 0xFF,
+    0xEF, 0xAF, 0xAA, 0xFE, 0xFF, 0xFF, 0xBF, 0xFE, 0xAB, 0xFE, 0xFF, 0xAF, 0xFA, 0xAF, 0xAA, 0xFF,
+    0xFF, 0xAB, 0xEA, 0xFF, 0xFF, 0xAA, 0xFF, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xFE,
+    0xFF, 0xAA, 0xAF, 0xAA, 0xAA, 0x2A, 0xFF, 0xBF, 0xDA, 0xAB, 0xAA, 0xD5, 0xBF, 0xAA, 0x6A, 0x55,
+    0xFD, 0x6B, 0x75, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xAA, 0xAF, 0xAA, 0xAA, 0xAA, 0xFC, 0xBF, 0xEA, 0xAB, 0xAA, 0xEA,
+    0xBF, 0xAA, 0xAA, 0xAA, 0xFF, 0xAB, 0xBE, 0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA, 0xAB,
+    0xAE, 0xAA, 0xAA, 0xFE, 0xFF, 0xEB, 0xAB, 0xFF, 0xAF, 0xAF, 0xAA, 0xEA, 0xFF, 0xFF, 0xBF, 0xFE,
+    0xAB, 0xFE, 0xFF, 0xAF, 0xFA, 0xAF, 0xFA, 0xFF, 0xFF, 0xAB, 0xFE, 0xFF, 0xFF, 0xFA, 0xFF, 0xAA,
+    0xFA, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x0A, 0x00, 0x00, 0xAA, 0xAC, 0xAA, 0xAA, 0xAA, 0xF2, 0xBF,
+    0x6A, 0xAB, 0xAA, 0x6A, 0xB5, 0xAA, 0x6A, 0x55, 0x55, 0x69, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xEA, 0xAA, 0xAE, 0xAA,
+    0xAA, 0xAA, 0xCA, 0xBF, 0xAA, 0xAB, 0xAA, 0xAA, 0xBA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xBA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xFA, 0xAA, 0xAE, 0xAA, 0xAA, 0xAA, 0x2A, 0xBF, 0xAA, 0xAB, 0xAA, 0xAA, 0xBA, 0xAA, 0xAA, 0xAA,
+    0xEA, 0xAB, 0xBA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xFE, 0xAA, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0xBC, 0xAA, 0xAB, 0xAA, 0xAA,
+    0xBA, 0xAA, 0xAA, 0xAA, 0xFA, 0xAB, 0xBA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFE, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFF, 0xAA, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0xB2,
+    0xAA, 0xAB, 0xAA, 0xAA, 0xBA, 0xAA, 0xAA, 0xAA, 0xFE, 0xAB, 0xBA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFF,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0A, 0x00, 0x00, 0xAA, 0xA2, 0xAA,
+    0xAA, 0xAA, 0xAA, 0x8A, 0xAA, 0xA9, 0xAA, 0xAA, 0x95, 0xAA, 0x6A, 0xAA, 0x56, 0x69, 0x5A, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x40, 0x15, 0x00, 0x01,
+    0x00, 0x04, 0x41, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x01, 0x00,
+    0x40, 0x55, 0x55, 0x01, 0x00, 0x54, 0x41, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x54, 0x00, 0x00, 0x40, 0x55, 0x01, 0x00, 0x50, 0x41, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x40, 0x55, 0x01, 0x40, 0x45, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x05, 0x00, 0x40, 0x55,
+    0x55, 0x41, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0x00, 0x40, 0x00, 0x54, 0x41, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0x01, 0x01, 0x40, 0x55, 0x55, 0x05, 0x00, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x5F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xC7, 0xFF, 0xFF, 0x7F, 0xD5, 0xFF, 0xFF, 0xFF, 0xF7, 0x7F, 0xF5,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0x2B, 0xFF, 0xFF, 0xBF, 0xEA, 0xFF, 0xFF,
+    0xFF, 0xFB, 0xBF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x54, 0x01,
+    0x80, 0x6A, 0x55, 0x05, 0x00, 0x58, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0xF1, 0x01, 0x40, 0x55, 0x55, 0x05, 0x00, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x56, 0xC9, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x59, 0x55, 0x29, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x75, 0x57, 0x55, 0x7C,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x7F, 0x57, 0x55, 0x72, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x4A, 0x05, 0x00, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x15, 0x3F, 0x00, 0x50, 0x55,
+    0xFD, 0x57, 0x75, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xAA, 0xAA,
+    0xBC, 0xAA, 0xAA, 0xAA, 0xFE, 0xAB, 0xBA, 0xAA, 0xAA, 0xAA, 0xAA, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x5A, 0xAA, 0xA6, 0xAA, 0xAA, 0xAA, 0xAA, 0x96,
+    0xAA, 0xA9, 0xAA, 0xAA, 0x92, 0xAA, 0xAA, 0xAA, 0x56, 0xA9, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0x56,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x05, 0x00, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0xFF, 0x05, 0x00, 0xFF, 0xFF, 0x55,
+    0x01, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0xAA, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xAF, 0xEA, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0xFF, 0xFA,
+    0xBF, 0xFC, 0xFF, 0xAA, 0xFE, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xAF, 0xFA, 0xFF, 0xFF, 0xFF, 0xBF,
+    0xFF, 0xFB, 0xFF, 0xFF, 0xBF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFB, 0xBF, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x08, 0x00, 0x00, 0x80, 0x0A, 0x00, 0x00, 0x00, 0x08, 0x80, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0xFC, 0x05, 0x00, 0x00, 0xFF, 0x55,
+    0x01, 0xD1, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0xAA, 0xAA, 0xFE, 0xFF, 0xFF, 0xFA, 0xAF, 0xAA, 0xFE, 0xFF, 0xFF, 0xBF, 0xFE, 0xAB, 0xFE, 0xFF,
+    0xBF, 0xAA, 0xFC, 0xFF, 0xFF, 0xEB, 0xBF, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xEB,
+    0xAF, 0xAA, 0xFA, 0xFF, 0xFF, 0xEB, 0xAB, 0xAA, 0xAF, 0xAF, 0xAA, 0xAA, 0xEA, 0xFF, 0xBF, 0xEA,
+    0xAB, 0xAA, 0xFA, 0xAF, 0xAA, 0xAF, 0xAA, 0xFA, 0xFF, 0xAB, 0xAA, 0xFE, 0xFF, 0xAA, 0xFA, 0xAA,
+    0xAA, 0xAA, 0xEA, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xA8, 0x02, 0x0F, 0x80, 0xAA, 0xF2, 0xFF, 0x03, 0xEB, 0xBF, 0xAA, 0xEA, 0xFF, 0xFF, 0xFF,
+    0xFE, 0xFE, 0xFF, 0xFB, 0xAF, 0xAA, 0xFA, 0xFF, 0xFF, 0xEB, 0xAB, 0xEA, 0xAF, 0xAF, 0xAA, 0xAA,
+    0xFA, 0xFF, 0xBF, 0xEA, 0xAB, 0xAA, 0xFA, 0xAF, 0xAA, 0xAF, 0xAA, 0xFA, 0xFF, 0xAB, 0xAA, 0xFE,
+    0xFF, 0xAA, 0xFA, 0xAA, 0xAA, 0xAA, 0xFA, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0xA8, 0x02, 0xFF, 0xBF, 0xAA, 0xCA, 0xFF, 0xFF, 0xEB, 0xBF, 0xAA,
+    0xFA, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFB, 0xAF, 0xAA, 0xFE, 0xFF, 0xFF, 0xFB, 0xFB, 0xFF,
+    0xEF, 0xAF, 0xAA, 0xFE, 0xFF, 0xFF, 0xBF, 0xFE, 0xAB, 0xFE, 0xFF, 0xAF, 0xFA, 0xAF, 0xAA, 0xFF,
+    0xFF, 0xAB, 0xEA, 0xFF, 0xFF, 0xAA, 0xFF, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xA9, 0x02, 0x55, 0x95, 0xAA, 0x2A, 0x55,
+    0x55, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xC5, 0x54, 0x55, 0xC0,
+    0x7F, 0x55, 0x55, 0xFC, 0xFF, 0x57, 0x5D, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC0, 0xA8, 0xAA, 0xC0, 0xBF, 0xAA, 0xAA, 0xF2, 0xFF, 0xAB, 0xBE, 0xAA, 0xAA, 0xAA, 0xFA, 0xFF,
+    0xEA, 0xAA, 0xAA, 0xAB, 0xAE, 0xAA, 0xAA, 0xEA, 0xFF, 0xAB, 0xAB, 0xAA, 0xAE, 0xAE, 0xAA, 0xAA,
+    0xAA, 0xFE, 0xBF, 0xEA, 0xAB, 0xAA, 0xFA, 0xAF, 0xAA, 0xAF, 0xAA, 0xFA, 0xFF, 0xAB, 0xAA, 0xFE,
+    0xFF, 0xAA, 0xFA, 0xAA, 0xAA, 0xAA, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xA0, 0xC0, 0xBF, 0x80, 0xAA, 0xCA, 0xFF, 0xAB, 0xBE, 0xAA,
+    0xAA, 0xAA, 0xFE, 0xFF, 0xEA, 0xAA, 0xAA, 0xAB, 0xAE, 0xAA, 0xAA, 0xFA, 0xFF, 0xAB, 0xAB, 0xAA,
+    0xAE, 0xAE, 0xAA, 0xAA, 0xAA, 0xFF, 0xBF, 0xEA, 0xAB, 0xAA, 0xFA, 0xAF, 0xAA, 0xAF, 0xAA, 0xFA,
+    0xFF, 0xAB, 0xAA, 0xFE, 0xFF, 0xAA, 0xFA, 0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xFF,
+    0xFF, 0xAA, 0xAF, 0xAA, 0xAA, 0xAA, 0xFE, 0xBF, 0xEA, 0xAB, 0xAA, 0xEA, 0xBF, 0xAA, 0xAA, 0x2A,
+    0xFF, 0xAB, 0xBE, 0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA, 0xAB, 0xAE, 0xAA, 0xAA, 0xFE,
+    0xFF, 0xEB, 0xAB, 0xFF, 0xAF, 0xAF, 0xAA, 0xEA, 0xFF, 0xFF, 0xBF, 0xFE, 0xAB, 0xFE, 0xFF, 0xAF,
+    0xFA, 0xAF, 0xFA, 0xFF, 0xFF, 0xAB, 0xFE, 0xFF, 0xFF, 0xFA, 0xFF, 0xAA, 0xFA, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x50, 0x2A,
+    0x40, 0x40, 0x55, 0xAA, 0x00, 0x54, 0x46, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x3C,
+    0x00, 0x03, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xFE, 0xAA, 0xAE, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xBF, 0xAA, 0xAB, 0xAA, 0xAA, 0xBA, 0xAA, 0xAA, 0xAA, 0xCA, 0xAB, 0xBA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xFF, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xFF, 0xAA, 0xAE, 0xAA, 0xAA, 0xAA, 0xEA, 0xBF, 0xAA, 0xAB, 0xAA, 0xAA, 0xBA, 0xAA, 0xAA, 0xAA,
+    0x2A, 0xAB, 0xBA, 0xAA, 0xAA, 0xAA, 0xEA, 0xFF, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x50, 0xAA,
+    0x4A, 0x40, 0x55, 0xAA, 0xAA, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0x15, 0x00, 0x00, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x15, 0x00, 0x00, 0x55, 0x55, 0x05, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x50,
+    0x55, 0x00, 0x05, 0x00, 0x00, 0x40, 0x55, 0x15, 0x50, 0x01, 0x00, 0x55, 0x15, 0x00, 0x00, 0x55,
+    0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x05, 0x00, 0x00, 0x00, 0x05, 0x50, 0x55, 0x05, 0x00, 0x00, 0x40, 0x05, 0x54, 0x55, 0x00,
+    0x40, 0x55, 0x55, 0x00, 0x00, 0x54, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x54, 0x55, 0x00, 0x40, 0x55, 0x55, 0x00, 0x00, 0x54, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x55, 0x00, 0x40, 0x55, 0x55, 0x00, 0x00, 0x54, 0x45, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xFC, 0xFF, 0x3F, 0xC0, 0xFF, 0xFF,
+    0xFF, 0xF3, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xAA, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xAF, 0xEA, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xAB, 0xFF, 0xFF,
+    0xBF, 0xEA, 0xFF, 0xFF, 0xFF, 0xFB, 0xBF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xAF, 0xFA, 0xFF, 0xFF, 0xFF, 0xBF,
+    0xFF, 0xEB, 0xFF, 0xFF, 0xBF, 0xEA, 0xFF, 0xFF, 0xFF, 0xFB, 0xBF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xAF, 0xFE,
+    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xBF, 0xEA, 0xFF, 0xFF, 0xFF, 0xFB, 0xBF, 0xCA,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFE, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xBF, 0xFA, 0xFF, 0xFF,
+    0xFF, 0xFB, 0xBF, 0x2A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF0, 0x0B, 0x00, 0xFF,
+    0xBF, 0x00, 0x00, 0xFF, 0xFF, 0xCB, 0xBF, 0xAA, 0xFC, 0xFF, 0xFF, 0xFF, 0xFD, 0xF5, 0xFF, 0xD7,
+    0x5F, 0x55, 0xF5, 0xFF, 0xFF, 0xD7, 0x57, 0x55, 0x5D, 0x5D, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xFA, 0xFF, 0xAA, 0xAF, 0xAA, 0xAA, 0xEA, 0xFF, 0xBF,
+    0xFA, 0xAB, 0xEA, 0xFF, 0xBF, 0xAA, 0xEA, 0xFF, 0xFF, 0xEB, 0xBF, 0xAA, 0xF2, 0xFF, 0xFF, 0xFF,
+    0xFE, 0xFE, 0xFF, 0xEB, 0xAF, 0xAA, 0xFA, 0xFF, 0xFF, 0xEB, 0xAB, 0xAA, 0xAF, 0xAF, 0xAA, 0xAA,
+    0xEA, 0xFF, 0xBF, 0xEA, 0xAB, 0xAA, 0xFA, 0xAF, 0xAA, 0xAF, 0xAA, 0xFA, 0xFF, 0xAB, 0xAA, 0xFE,
+    0xFF, 0xAA, 0xFA, 0xAA, 0xAA, 0xAA, 0xEA, 0xFF, 0xAA, 0xAA, 0xAA, 0xFE, 0xFF, 0xAA, 0xAF, 0xAA,
+    0xAA, 0xFA, 0xFF, 0xBF, 0xFA, 0xAB, 0xFA, 0xFF, 0xBF, 0xAA, 0xFA, 0xFF, 0xFF, 0xEB, 0xBF, 0xAA,
+    0xCA, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFB, 0xAF, 0xAA, 0xFA, 0xFF, 0xFF, 0xEB, 0xAB, 0xEA,
+    0xAF, 0xAF, 0xAA, 0xAA, 0xFA, 0xFF, 0xBF, 0xEA, 0xAB, 0xAA, 0xFA, 0xAF, 0xAA, 0xAF, 0xAA, 0xFA,
+    0xFF, 0xAB, 0xAA, 0xFE, 0xFF, 0xAA, 0xFA, 0xAA, 0xAA, 0xAA, 0xFA, 0xFF, 0xAA, 0xAA, 0xFE, 0xFF,
+    0xFF, 0xFA, 0xAF, 0xAA, 0xFE, 0xFF, 0xFF, 0xBF, 0xFE, 0xAB, 0xFE, 0xFF, 0xBF, 0xAA, 0xFE, 0xFF,
+    0xFF, 0xEB, 0xBF, 0xAA, 0x2A, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFB, 0xAF, 0xAA, 0xFE, 0xFF,
+    0xFF, 0xFB, 0xFB, 0xFF, 0xEF, 0xAF, 0xAA, 0xFE, 0xFF, 0xFF, 0xBF, 0xFE, 0xAB, 0xFE, 0xFF, 0xAF,
+    0xFA, 0xAF, 0xAA, 0xFF, 0xFF, 0xAB, 0xEA, 0xFF, 0xFF, 0xAA, 0xFF, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0xFC, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0xFF, 0xBF, 0xF0, 0x0B, 0x00, 0xFF,
+    0xBF, 0x00, 0x00, 0xFF, 0xFF, 0x2B, 0xBF, 0xAA, 0xAA, 0xFC, 0xFF, 0xFF, 0xF6, 0x56, 0x55, 0x5B,
+    0x5D, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xFA, 0xFF, 0xFF, 0xEA, 0xAF, 0xAA, 0xAA, 0xFE, 0xFF, 0xBF,
+    0xFA, 0xAB, 0xAA, 0xFF, 0xBF, 0xAA, 0xAA, 0xFF, 0xFF, 0xAB, 0xBF, 0xAA, 0xAA, 0xF2, 0xFF, 0xFF,
+    0xFA, 0xAA, 0xFE, 0xAB, 0xAF, 0xAA, 0xAA, 0xFE, 0xFF, 0xEB, 0xAB, 0xFA, 0xAF, 0xAF, 0xAA, 0xAA,
+    0xFE, 0xFF, 0xBF, 0xFA, 0xAB, 0xFA, 0xFF, 0xAF, 0xEA, 0xAF, 0xAA, 0xFE, 0xFF, 0xAB, 0xAA, 0xFF,
+    0xFF, 0xAA, 0xFE, 0xAA, 0xAA, 0xFA, 0xFF, 0xFF, 0xAA, 0x2A, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0xAA,
+    0x2A, 0x00, 0x00, 0x80, 0x0A, 0xAB, 0xAA, 0x00, 0xB0, 0xAA, 0xAA, 0x00, 0x00, 0xAB, 0xBC, 0xAA,
+    0xAA, 0xCA, 0xFF, 0xFF, 0xDA, 0x56, 0x55, 0x5B, 0x5D, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xFF,
+    0xFF, 0xAA, 0xAF, 0xAA, 0xAA, 0xAA, 0xFE, 0xBF, 0xEA, 0xAB, 0xAA, 0xEA, 0xBF, 0xAA, 0xAA, 0xAA,
+    0xFF, 0xAB, 0xBE, 0xAA, 0xAA, 0x2A, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA, 0xAB, 0xAE, 0xAA, 0xAA, 0xEA,
+    0xFF, 0xAB, 0xAB, 0xAA, 0xAE, 0xAE, 0xAA, 0xAA, 0xAA, 0xFE, 0xBF, 0xEA, 0xAB, 0xAA, 0xFA, 0xAF,
+    0xAA, 0xAF, 0xAA, 0xFA, 0xFF, 0xAB, 0xAA, 0xFE, 0xFF, 0xAA, 0xFA, 0xAA, 0xAA, 0xAA, 0xFE, 0xFF,
+    0xAA, 0xAA, 0xEA, 0xFF, 0xFF, 0xAA, 0xAF, 0xAA, 0xAA, 0xAA, 0xFF, 0xBF, 0xEA, 0xAB, 0xAA, 0xEA,
+    0xBF, 0xAA, 0xAA, 0xEA, 0xFF, 0xAB, 0xBE, 0xAA, 0xAA, 0xAA, 0xFC, 0xFF, 0xEA, 0xAA, 0xAA, 0xAB,
+    0xAE, 0xAA, 0xAA, 0xFA, 0xFF, 0xAB, 0xAB, 0xAA, 0xAE, 0xAE, 0xAA, 0xAA, 0xAA, 0xFF, 0xBF, 0xEA,
+    0xAB, 0xAA, 0xFA, 0xAF, 0xAA, 0xAF, 0xAA, 0xFA, 0xFF, 0xAB, 0xAA, 0xFE, 0xFF, 0xAA, 0xFA, 0xAA,
+    0xAA, 0xAA, 0xFF, 0xFF, 0xAA, 0xEA, 0xFF, 0xFF, 0xFF, 0xFA, 0xAF, 0xAA, 0xEA, 0xFF, 0xFF, 0xBF,
+    0xFA, 0xAB, 0xAA, 0xFA, 0xBF, 0xAA, 0xAA, 0xFA, 0xFF, 0xAB, 0xBE, 0xAA, 0xAA, 0xAA, 0xF2, 0xFF,
+    0xEA, 0xAA, 0xAA, 0xAB, 0xAE, 0xAA, 0xAA, 0xFE, 0xFF, 0xEB, 0xAB, 0xFF, 0xAF, 0xAF, 0xAA, 0xEA,
+    0xFF, 0xFF, 0xBF, 0xFE, 0xAB, 0xFE, 0xFF, 0xAF, 0xFA, 0xAF, 0xFA, 0xFF, 0xFF, 0xAB, 0xFE, 0xFF,
+    0xFF, 0xFA, 0xFF, 0xAA, 0xFA, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x0A, 0xAB, 0xAA, 0x00, 0xB0, 0xAA, 0xAA, 0x00, 0x00, 0xAB, 0xB2, 0xAA,
+    0xAA, 0xAA, 0xCA, 0xFF, 0x6A, 0xAA, 0x6A, 0xA9, 0xA5, 0xAA, 0xAA, 0x56, 0x55, 0x69, 0x59, 0x55,
+    0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xEA, 0xAA, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0xBA, 0xAA, 0xAB, 0xAA, 0xAA, 0xBA, 0xAA, 0xAA, 0xAA,
+    0xEA, 0xAB, 0xBA, 0xAA, 0xAA, 0xAA, 0x2A, 0xFF, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xFA, 0xAA, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0xBE, 0xAA, 0xAB, 0xAA, 0xAA,
+    0xBA, 0xAA, 0xAA, 0xAA, 0xFA, 0xAB, 0xBA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFE, 0xAA, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0xBF,
+    0xAA, 0xAB, 0xAA, 0xAA, 0xBA, 0xAA, 0xAA, 0xAA, 0xFE, 0xAB, 0xBA, 0xAA, 0xAA, 0xAA, 0xAA, 0xF2,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFF, 0xAA, 0xAE, 0xAA,
+    0xAA, 0xAA, 0xEA, 0xBF, 0xAA, 0xAB, 0xAA, 0xAA, 0xBE, 0xAA, 0xAA, 0xAA, 0xFE, 0xAB, 0xBA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x2A, 0xA8, 0xAA, 0x2A, 0x80, 0xAA, 0xAA, 0xAA,
+    0x02, 0xA8, 0x8A, 0xAA, 0xAA, 0xAA, 0xAA, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x14,
+    0x50, 0x55, 0x05, 0x00, 0x00, 0x14, 0x54, 0x55, 0x51, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x54, 0x55, 0x50, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x55, 0x50, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0x05, 0x00, 0x00, 0x54,
+    0x55, 0x41, 0x51, 0x55, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x14,
+    0x50, 0x55, 0x05, 0x00, 0x00, 0x54, 0x54, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xF5, 0x5F, 0x55, 0xFF, 0xFF, 0xFF, 0x7F,
+    0xFD, 0x57, 0xFD, 0xFF, 0x7F, 0x55, 0xFF, 0xFF, 0xFF, 0xD7, 0x7F, 0x55, 0xFD, 0xFF, 0xFF, 0xFF,
+    0xFD, 0xF1, 0xFF, 0xD7, 0x5F, 0x55, 0xF5, 0xFF, 0xFF, 0xD7, 0x57, 0x55, 0x5D, 0x5D, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xCA, 0xFF, 0xEB, 0xAF, 0xAA, 0xFA, 0xFF, 0xFF, 0xEB, 0xAB, 0xAA,
+    0xAF, 0xAF, 0xAA, 0xAA, 0xEA, 0xFF, 0xBF, 0xEA, 0xAB, 0xAA, 0xFA, 0xAF, 0xAA, 0xAF, 0xAA, 0xFA,
+    0xFF, 0xAB, 0xAA, 0xFE, 0xFF, 0xAA, 0xFA, 0xAA, 0xAA, 0xAA, 0xEA, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x28, 0xFF, 0xE8, 0xAF, 0xAA, 0xFA, 0xFF,
+    0xFF, 0xEB, 0xAB, 0xEA, 0xAF, 0xAF, 0xAA, 0xAA, 0xFA, 0xFF, 0xBF, 0xEA, 0xAB, 0xAA, 0xFA, 0xAF,
+    0xAA, 0xAF, 0xAA, 0xFA, 0xFF, 0xAB, 0xAA, 0xFE, 0xFF, 0xAA, 0xFA, 0xAA, 0xAA, 0xAA, 0xFA, 0xFF,
+    0xAA, 0xAA, 0xFA, 0xFF, 0xFF, 0xEA, 0xAF, 0xAA, 0xAA, 0xFE, 0xFF, 0xBF, 0xFA, 0xAB, 0xAA, 0xFF,
+    0xBF, 0xAA, 0xAA, 0xFF, 0xFF, 0xAB, 0xBF, 0xAA, 0xAA, 0xFA, 0xFF, 0xFF, 0xFA, 0xAA, 0xFC, 0x6B,
+    0xAF, 0xAA, 0x5A, 0xFD, 0xFF, 0xEB, 0xAB, 0xFA, 0xAF, 0xAF, 0xAA, 0xAA, 0xFE, 0xFF, 0xBF, 0xFA,
+    0xAB, 0xFA, 0xFF, 0xAF, 0xEA, 0xAF, 0xAA, 0xFE, 0xFF, 0xAB, 0xAA, 0xFF, 0xFF, 0xAA, 0xFE, 0xAA,
+    0xAA, 0xFA, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0xA8, 0xF2, 0xA8, 0xAF, 0xAA, 0xAA, 0xFE, 0xFF, 0xEB, 0xAB, 0xFE, 0xAF, 0xAF, 0xAA, 0xAA,
+    0xFF, 0xFF, 0xBF, 0xFA, 0xAB, 0xFA, 0xFF, 0xAF, 0xEA, 0xAF, 0xAA, 0xFE, 0xFF, 0xAB, 0xAA, 0xFF,
+    0xFF, 0xAA, 0xFE, 0xAA, 0xAA, 0xFA, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xCA, 0xAB, 0xAF, 0xAA, 0xAA, 0xFE, 0xFF, 0xEB, 0xAB, 0xFF,
+    0xAF, 0xAF, 0xAA, 0xEA, 0xFF, 0xFF, 0xBF, 0xFE, 0xAB, 0xFE, 0xFF, 0xAF, 0xFA, 0xAF, 0xFA, 0xFF,
+    0xFF, 0xAB, 0xFE, 0xFF, 0xFF, 0xFA, 0xFF, 0xAA, 0xFA, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0x55,
+    0x55, 0xAA, 0xA5, 0xAA, 0xAA, 0xAA, 0x56, 0x95, 0x6A, 0xA9, 0xAA, 0x6A, 0x95, 0xAA, 0xAA, 0xAA,
+    0x55, 0xA9, 0x96, 0xAA, 0xAA, 0xAA, 0x5A, 0x55, 0x6A, 0xAA, 0x2A, 0xA9, 0xA5, 0xAA, 0xAA, 0x56,
+    0x55, 0x69, 0x59, 0x55, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
+    0x05, 0x00, 0x00, 0x54, 0x55, 0x51, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x54, 0x55, 0x50, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x05, 0x50, 0x55,
+    0x00, 0x00, 0x00, 0x40, 0x01, 0x54, 0x01, 0x00, 0x40, 0x55, 0x00, 0x00, 0x00, 0x14, 0x40, 0x55,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x04, 0x50, 0x55, 0x05, 0x00, 0x00, 0x14, 0x54, 0x55,
+    0x51, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x54, 0x15, 0x40, 0x01, 0x00, 0x40,
+    0x15, 0x00, 0x00, 0x00, 0x55, 0x01, 0x14, 0x00, 0x00, 0x00, 0x50, 0x55, 0x40, 0x00, 0x00, 0x01,
+    0x04, 0x00, 0x00, 0x54, 0x55, 0x41, 0x51, 0x55, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x54, 0x55, 0x50, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xAF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xCA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFC, 0xFF, 0xF0, 0xAF, 0x2A, 0xFF, 0xFF,
+    0xFF, 0xF7, 0xF7, 0xFF, 0xD7, 0x57, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0xAA, 0xAA, 0xAA, 0xFA, 0xFF, 0xAA, 0xAF, 0xAA, 0xAA, 0xEA, 0xFF, 0xBF, 0xFA, 0xAB, 0xEA, 0xFF,
+    0xBF, 0xAA, 0xEA, 0xFF, 0xFF, 0xEB, 0xBF, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFB,
+    0xAF, 0xAA, 0xFC, 0xFF, 0xFF, 0xFB, 0xFB, 0xFF, 0xEF, 0xAF, 0xAA, 0xFE, 0xFF, 0xFF, 0xBF, 0xFE,
+    0xAB, 0xFE, 0xFF, 0xAF, 0xFA, 0xAF, 0xAA, 0xFF, 0xFF, 0xAB, 0xEA, 0xFF, 0xFF, 0xAA, 0xFF, 0xAA,
+    0xAA, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x02, 0x00, 0x00, 0x0A, 0xA0, 0xAA, 0x02, 0x00, 0x00, 0x80,
+    0x02, 0xA8, 0x02, 0x00, 0x80, 0xAA, 0x02, 0x00, 0x00, 0x28, 0x80, 0xAA, 0x0A, 0x00, 0x00, 0x00,
+    0x02, 0x02, 0x00, 0x08, 0xA0, 0xAA, 0x02, 0x00, 0x00, 0x58, 0x58, 0x55, 0x61, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xA8, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xFF, 0x3F,
+    0xC0, 0x03, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0xC0, 0xFF, 0x03, 0x3C, 0x00, 0x00, 0x00, 0xFC, 0xFF,
+    0xC0, 0x00, 0x00, 0x03, 0x0C, 0x00, 0x00, 0xF0, 0xFF, 0x53, 0x53, 0x55, 0x5D, 0x5D, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xEA, 0xFF, 0xFF, 0xFF, 0xFA, 0xAF, 0xAA,
+    0xEA, 0xFF, 0xFF, 0xBF, 0xFA, 0xAB, 0xAA, 0xFA, 0xBF, 0xAA, 0xAA, 0xFA, 0xFF, 0xAB, 0xBE, 0xAA,
+    0xAA, 0xAA, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA, 0xAB, 0xAE, 0xAA, 0xAA, 0xCA, 0xFF, 0xAB, 0xAB, 0xAA,
+    0xAE, 0xAE, 0xAA, 0xAA, 0xAA, 0xFE, 0xBF, 0xEA, 0xAB, 0xAA, 0xFA, 0xAF, 0xAA, 0xAF, 0xAA, 0xFA,
+    0xFF, 0xAB, 0xAA, 0xFE, 0xFF, 0xAA, 0xFA, 0xAA, 0xAA, 0xAA, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xA8, 0xAA, 0xA8, 0xA2, 0xAA, 0xAA, 0x2A,
+    0xFF, 0xAB, 0xA5, 0xAA, 0x96, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0xAB, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xF2, 0xAB, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xCA, 0xAB, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x2A, 0xAB, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x14, 0x54, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x54, 0x55, 0x41, 0x51, 0x55,
+    0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x50, 0x55, 0x05, 0x00,
+    0x00, 0x14, 0x54, 0x55, 0x51, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x14, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x54, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x03, 0x0F, 0x00, 0x00, 0xFC, 0xFF, 0xC3, 0xC3, 0xFF,
+    0x57, 0x57, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xFF,
+    0xFF, 0xAA, 0xAF, 0xAA, 0xAA, 0xAA, 0xFE, 0xBF, 0xEA, 0xAB, 0xAA, 0xEA, 0xBF, 0xAA, 0xAA, 0xAA,
+    0xFF, 0xAB, 0xBE, 0xAA, 0xAA, 0xAA, 0xFA, 0xFF, 0xEA, 0xAA, 0xEA, 0xAB, 0xAF, 0xAA, 0xAA, 0xFE,
+    0xFF, 0xEB, 0x2B, 0xFF, 0xAF, 0xAF, 0xAA, 0xAA, 0xEA, 0xFF, 0xBF, 0xEA, 0xAB, 0xAA, 0xFA, 0xAF,
+    0xAA, 0xAF, 0xAA, 0xFA, 0xFF, 0xAB, 0xAA, 0xFE, 0xFF, 0xAA, 0xFA, 0xAA, 0xAA, 0xAA, 0xEA, 0xFF,
+    0xAA, 0xAA, 0xEA, 0xFF, 0xFF, 0xAA, 0xAF, 0xAA, 0xAA, 0xAA, 0xFF, 0xBF, 0xEA, 0xAB, 0xAA, 0xEA,
+    0xBF, 0xAA, 0xAA, 0xEA, 0xFF, 0xAB, 0xBE, 0xAA, 0xAA, 0xAA, 0xFE, 0xFF, 0xEA, 0xAA, 0xFA, 0xAB,
+    0xAF, 0xAA, 0xAA, 0xFE, 0xFF, 0xEB, 0xAB, 0xFC, 0xAF, 0xAF, 0xAA, 0xAA, 0xFA, 0xFF, 0xBF, 0xEA,
+    0xAB, 0xAA, 0xFA, 0xAF, 0xAA, 0xAF, 0xAA, 0xFA, 0xFF, 0xAB, 0xAA, 0xFE, 0xFF, 0xAA, 0xFA, 0xAA,
+    0xAA, 0xAA, 0xFA, 0xFF, 0xAA, 0xAA, 0xFA, 0xFF, 0xFF, 0xEA, 0xAF, 0xAA, 0xAA, 0xFE, 0xFF, 0xBF,
+    0xFA, 0xAB, 0xAA, 0xFF, 0xBF, 0xAA, 0xAA, 0xFF, 0xFF, 0xAB, 0xBF, 0xAA, 0xAA, 0xFA, 0xFF, 0xFF,
+    0xFA, 0xAA, 0xFE, 0xAB, 0xAF, 0xAA, 0xAA, 0xFE, 0xFF, 0xEB, 0xAB, 0xF2, 0xAF, 0xAF, 0xAA, 0xAA,
+    0xFE, 0xFF, 0xBF, 0xFA, 0xAB, 0xFA, 0xFF, 0xAF, 0xEA, 0xAF, 0xAA, 0xFE, 0xFF, 0xAB, 0xAA, 0xFF,
+    0xFF, 0xAA, 0xFE, 0xAA, 0xAA, 0xFA, 0xFF, 0xFF, 0xAA, 0xAA, 0xFA, 0xFF, 0xFF, 0xEA, 0xAF, 0xAA,
+    0xAA, 0xFF, 0xFF, 0xBF, 0xFA, 0xAB, 0xAA, 0xFF, 0xBF, 0xAA, 0xAA, 0xFF, 0xFF, 0xAB, 0xBF, 0xAA,
+    0xAA, 0xFE, 0xFF, 0xFF, 0xFA, 0xAA, 0xFF, 0xEB, 0xAF, 0xAA, 0xFA, 0xFF, 0xFF, 0xEB, 0xAB, 0xCA,
+    0xAF, 0xAF, 0xAA, 0xAA, 0xFF, 0xFF, 0xBF, 0xFA, 0xAB, 0xFA, 0xFF, 0xAF, 0xEA, 0xAF, 0xAA, 0xFE,
+    0xFF, 0xAB, 0xAA, 0xFF, 0xFF, 0xAA, 0xFE, 0xAA, 0xAA, 0xFA, 0xFF, 0xFF, 0xAA, 0xAA, 0xFE, 0xFF,
+    0xFF, 0xFA, 0xAF, 0xAA, 0xFE, 0xFF, 0xFF, 0xBF, 0xFE, 0xAB, 0xFE, 0xFF, 0xBF, 0xAA, 0xFE, 0xFF,
+    0xFF, 0xEB, 0xBF, 0xAA, 0xFA, 0xFF, 0xFF, 0xFF, 0xFE, 0xEA, 0xFF, 0xEB, 0xAF, 0xAA, 0xFA, 0xFF,
+    0xFF, 0xEB, 0xAB, 0x2A, 0xAF, 0xAF, 0xAA, 0xEA, 0xFF, 0xFF, 0xBF, 0xFE, 0xAB, 0xFE, 0xFF, 0xAF,
+    0xFA, 0xAF, 0xFA, 0xFF, 0xFF, 0xAB, 0xFE, 0xFF, 0xFF, 0xFA, 0xFF, 0xAA, 0xFA, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x28,
+    0xA0, 0xAA, 0x0A, 0x00, 0x00, 0x28, 0xA4, 0xAA, 0x90, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x50, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x54, 0x55, 0x41, 0x51, 0x55,
+    0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x14, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x14, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x04, 0x50, 0x55, 0x05, 0x00, 0x00, 0x14, 0x54, 0x55, 0x51, 0x51, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0x5F, 0xFF,
+    0xFF, 0xF7, 0xD7, 0xFF, 0xFF, 0x5D, 0xFF, 0x55, 0x55, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xEF,
+    0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFC, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF,
+    0xFB, 0xFF, 0xFF, 0xEF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xEA,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xF2, 0xFF,
+    0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xEF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF,
+    0xFF, 0xFE, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xAF, 0xCA, 0xFF, 0xFF, 0xFF, 0xBF, 0xFD, 0x5B, 0xFD, 0xFF, 0x6F, 0xF5, 0x6F, 0x55, 0xFF,
+    0xFF, 0x5B, 0xD5, 0xFF, 0xFF, 0x56, 0xFF, 0x55, 0x55, 0xF5, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x03, 0x0F, 0x00, 0x00, 0xFC,
+    0xFF, 0xF3, 0xF3, 0xFF, 0xCF, 0xAF, 0x2A, 0xFF, 0xFF, 0xFF, 0xBF, 0xFE, 0xAB, 0xFE, 0xFF, 0xAF,
+    0xFA, 0xAF, 0xAA, 0xFF, 0xFF, 0xAB, 0xEA, 0xFF, 0xFF, 0xAA, 0xFF, 0xAA, 0xAA, 0xFE, 0xFF, 0xFF,
+    0xAA, 0xAA, 0xAA, 0xFA, 0xFF, 0xAA, 0xAF, 0xAA, 0xAA, 0xEA, 0xFF, 0xBF, 0xFA, 0xAB, 0xEA, 0xFF,
+    0xBF, 0xAA, 0xEA, 0xFF, 0xFF, 0xEB, 0xBF, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFB,
+    0xAF, 0xAA, 0xFE, 0xFF, 0xFF, 0xFB, 0xFB, 0xFF, 0xEF, 0xAF, 0xAA, 0xFC, 0xFF, 0xFF, 0xBF, 0xFE,
+    0xAB, 0xFE, 0xFF, 0xAF, 0xFA, 0xAF, 0xAA, 0xFF, 0xFF, 0xAB, 0xEA, 0xFF, 0xFF, 0xAA, 0xFF, 0xAA,
+    0xAA, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0B, 0x00, 0x2C, 0xAF, 0xAA, 0xF2,
+    0xFF, 0xFF, 0xBF, 0xFE, 0xAB, 0xFE, 0xFF, 0xAF, 0xFA, 0xAF, 0xEA, 0xFF, 0xFF, 0xAB, 0xFA, 0xFF,
+    0xFF, 0xEA, 0xFF, 0xAA, 0xEA, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xAA, 0xAF, 0xAA,
+    0xAA, 0xAA, 0xFE, 0xBF, 0xEA, 0xAB, 0xAA, 0xEA, 0xBF, 0xAA, 0xAA, 0xAA, 0xFF, 0xAB, 0xBE, 0xAA,
+    0xAA, 0xAA, 0xFA, 0xFF, 0xEA, 0xAA, 0xEA, 0xAB, 0xAF, 0xAA, 0xAA, 0xFE, 0xFF, 0xEB, 0xAB, 0xAA,
+    0xAF, 0xAF, 0xAA, 0xCA, 0xFF, 0xFF, 0xBF, 0xFE, 0xAB, 0xFE, 0xFF, 0xAF, 0xFA, 0xAF, 0xFA, 0xFF,
+    0xFF, 0xAB, 0xFE, 0xFF, 0xFF, 0xFA, 0xFF, 0xAA, 0xFA, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0xEA, 0xFF,
+    0xFF, 0xAA, 0xAF, 0xAA, 0xAA, 0xAA, 0xFF, 0xBF, 0xEA, 0xAB, 0xAA, 0xEA, 0xBF, 0xAA, 0xAA, 0xEA,
+    0xFF, 0xAB, 0xBE, 0xAA, 0xAA, 0xAA, 0xFE, 0xFF, 0xEA, 0xAA, 0xFA, 0xAB, 0xAF, 0xAA, 0xAA, 0xFE,
+    0xFF, 0xEB, 0xAB, 0xEA, 0xAF, 0xAF, 0xAA, 0x2A, 0xFF, 0xFF, 0xBF, 0xF6, 0xAB, 0xF6, 0xFF, 0xAF,
+    0xDA, 0xAF, 0x5A, 0xFD, 0xFF, 0xAB, 0x56, 0xFF, 0xFF, 0x5A, 0xFD, 0x55, 0x55, 0xF5, 0xFF, 0xFF,
+    0xAA, 0xAA, 0xFA, 0xFF, 0xFF, 0xEA, 0xAF, 0xAA, 0xAA, 0xFE, 0xFF, 0xBF, 0xFA, 0xAB, 0xAA, 0xFF,
+    0xBF, 0xAA, 0xAA, 0xFF, 0xFF, 0xAB, 0xBF, 0xAA, 0xAA, 0xFA, 0xFF, 0xFF, 0xFA, 0xAA, 0xFE, 0xAB,
+    0xAF, 0xAA, 0xAA, 0xFE, 0xFF, 0xEB, 0xAB, 0xFA, 0xAF, 0xAF, 0xAA, 0xAA, 0xFC, 0xFF, 0xBF, 0xFA,
+    0xAB, 0xFA, 0xFF, 0xAF, 0xEA, 0xAF, 0xAA, 0xFE, 0xFF, 0xAB, 0xAA, 0xFF, 0xFF, 0xAA, 0xFE, 0xAA,
+    0xAA, 0xFA, 0xFF, 0xFF, 0xAA, 0xAA, 0xFA, 0xFF, 0xFF, 0xEA, 0xAF, 0xAA, 0xAA, 0xFF, 0xFF, 0xBF,
+    0xFA, 0xAB, 0xAA, 0xFF, 0xBF, 0xAA, 0xAA, 0xFF, 0xFF, 0xAB, 0xBF, 0xAA, 0xAA, 0xFE, 0xFF, 0xFF,
+    0xFA, 0xAA, 0xFF, 0xEB, 0xAF, 0xAA, 0xFA, 0xFF, 0xFF, 0xEB, 0xAB, 0xFE, 0xAF, 0xAF, 0xAA, 0xAA,
+    0xF2, 0xFF, 0xBF, 0xDA, 0xAB, 0x5A, 0xF5, 0xAF, 0x6A, 0xAF, 0xAA, 0xF6, 0xFF, 0xAB, 0xAA, 0xFD,
+    0xFF, 0xAA, 0xF6, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0xAA, 0xAA, 0xFE, 0xFF, 0xFF, 0xFA, 0xAF, 0xAA,
+    0xFE, 0xFF, 0xFF, 0xBF, 0xFE, 0xAB, 0xFE, 0xFF, 0xBF, 0xAA, 0xFE, 0xFF, 0xFF, 0xEB, 0xBF, 0xAA,
+    0xFA, 0xFF, 0xFF, 0xFF, 0xFE, 0xEA, 0xFF, 0xEB, 0xAF, 0xAA, 0xFA, 0xFF, 0xFF, 0xEB, 0xAB, 0xFF,
+    0xAF, 0xAF, 0xAA, 0xAA, 0xCA, 0xFF, 0xBF, 0xEA, 0xAB, 0xAA, 0xFA, 0xAF, 0xAA, 0xAF, 0xAA, 0xFA,
+    0xFF, 0xAB, 0xAA, 0xFE, 0xFF, 0xAA, 0xFA, 0xAA, 0xAA, 0xAA, 0xEA, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x0B, 0x00, 0xAC, 0xAC, 0xAA, 0xAA, 0x2A, 0xFF, 0xBF, 0xEA, 0xAB, 0xAA, 0xFA, 0xAF,
+    0xAA, 0xAF, 0xAA, 0xFA, 0xFF, 0xAB, 0xAA, 0xFE, 0xFF, 0xAA, 0xFA, 0xAA, 0xAA, 0xAA, 0xFA, 0xFF,
+    0xAA, 0xEA, 0xFF, 0xFF, 0xFF, 0xFA, 0xAF, 0xAA, 0xEA, 0xFF, 0xFF, 0xBF, 0xFA, 0xAB, 0xAA, 0xFA,
+    0xBF, 0xAA, 0xAA, 0xFA, 0xFF, 0xAB, 0xBE, 0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA, 0xAB,
+    0xAE, 0xAA, 0xAA, 0xEA, 0xFF, 0xAB, 0xAB, 0xAA, 0xAE, 0xAE, 0xAA, 0xAA, 0xAA, 0xFC, 0xBF, 0xEA,
+    0xAB, 0xAA, 0xFA, 0xAF, 0xAA, 0xAF, 0xAA, 0xFA, 0xFF, 0xAB, 0xAA, 0xFE, 0xFF, 0xAA, 0xFA, 0xAA,
+    0xAA, 0xAA, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x02, 0x00, 0x28, 0xA0, 0xAA, 0x0A, 0x00, 0x00, 0xA8, 0xA8, 0xAA, 0xA2, 0xA2, 0xAA, 0xAA,
+    0xAA, 0xF2, 0xBF, 0xEA, 0xAB, 0xAA, 0xFA, 0xAF, 0xAA, 0xAF, 0xAA, 0xFA, 0xFF, 0xAB, 0xAA, 0xFE,
+    0xFF, 0xAA, 0xFA, 0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xCA, 0xBF, 0x6A, 0xAB, 0xAA, 0xDA, 0xAF, 0xAA, 0xAD, 0xAA, 0x5A,
+    0x55, 0xAB, 0xAA, 0x56, 0xD5, 0xAA, 0xDA, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x2A, 0xBF, 0xAA, 0xAB, 0xAA, 0xEA, 0xAF,
+    0xAA, 0xAE, 0xAA, 0xAA, 0xAA, 0xAB, 0xAA, 0xAA, 0xEA, 0xAA, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xEA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xBC, 0xAA,
+    0xAB, 0xAA, 0xEA, 0xAF, 0xAA, 0xAE, 0xAA, 0xAA, 0xAA, 0xAB, 0xAA, 0xAA, 0xEA, 0xAA, 0xEA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xB2, 0xAA, 0xAB, 0xAA, 0xEA, 0xAF, 0xAA, 0xAE, 0xAA, 0xAA, 0xAA, 0xAB, 0xAA, 0xAA,
+    0xEA, 0xAA, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFE, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x8A, 0xAA, 0xA9, 0xAA, 0x6A, 0xA5, 0xAA, 0xA6, 0xAA, 0xAA,
+    0xAA, 0xA9, 0xAA, 0xAA, 0x6A, 0xAA, 0x6A, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x10,
+    0x00, 0x10, 0x50, 0x00, 0x00, 0x04, 0x14, 0x00, 0x00, 0x51, 0x00, 0x55, 0x55, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0x01, 0x00, 0x40, 0x05, 0x40, 0x55, 0x00, 0x00, 0x50, 0x15, 0x00, 0x00, 0x54, 0x00, 0x55,
+    0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x10, 0x00, 0x50, 0x01, 0x00, 0x00, 0x54, 0x00,
+    0x00, 0x50, 0x01, 0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x05, 0x00, 0x40, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x50, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+    0x00, 0x01, 0x00, 0x50, 0x55, 0x00, 0x00, 0x54, 0x15, 0x00, 0x10, 0x00, 0x00, 0x50, 0x55, 0x55,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00,
+    0x00, 0x50, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x50, 0x00, 0x00, 0x04, 0x14, 0x00,
+    0x00, 0x55, 0x01, 0x55, 0x55, 0x05, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x7F, 0xF5, 0x7F, 0x55, 0xFF,
+    0xFF, 0x57, 0x55, 0xFF, 0xFF, 0x55, 0xFD, 0x55, 0x55, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0x7F,
+    0xF5, 0x7F, 0x55, 0xFF, 0xFF, 0x57, 0x55, 0xFF, 0xFF, 0x55, 0xFD, 0x55, 0x55, 0xF5, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xA0, 0x00, 0x00, 0x40, 0x05, 0x40, 0x55, 0x00, 0x00, 0x50, 0x15, 0x00, 0x00, 0x55, 0x01, 0x55,
+    0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50, 0x01, 0x00, 0x00, 0x54, 0x00,
+    0x00, 0x55, 0x01, 0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x40, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x54, 0x00, 0x00, 0x50, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x2A, 0xAF, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA2, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x50,
+    0x55, 0x00, 0x00, 0x54, 0x15, 0x00, 0x54, 0x00, 0x00, 0x50, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xBF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x40, 0x00, 0x54, 0x00, 0x00, 0x50, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x50, 0x00,
+    0x00, 0x54, 0x55, 0x00, 0x00, 0x55, 0x01, 0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0x40, 0x55, 0x00, 0x00, 0x54, 0x55, 0x00, 0x00, 0x55, 0x01, 0x55, 0x55, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x0C, 0x40, 0x55, 0x00, 0x00, 0x54, 0x55, 0x00, 0x00, 0x55, 0x01, 0x55,
+    0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x40, 0x55, 0x00, 0x00, 0x54, 0x55, 0x00,
+    0x00, 0x55, 0x01, 0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x01,
+    0x00, 0x54, 0x55, 0x00, 0x00, 0x55, 0x01, 0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x55, 0x55, 0x00, 0x54, 0x00, 0x00, 0x50, 0x55, 0x55,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x00, 0x00, 0x55, 0x55, 0x00, 0x54, 0x00,
+    0x00, 0x50, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x55,
+    0x55, 0x00, 0x54, 0x00, 0x00, 0x50, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x55, 0x01,
+    0x00, 0x54, 0x55, 0x00, 0x00, 0x55, 0x01, 0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x5F, 0x01, 0x00, 0x54, 0x55, 0x00, 0x00, 0x55, 0x01, 0x55, 0x55, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x5C, 0x01, 0x00, 0x54, 0x55, 0x00, 0x00, 0x55, 0x01, 0x55,
+    0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x52, 0x01, 0x00, 0x54, 0x55, 0x00,
+    0x00, 0x55, 0x01, 0x55, 0x55, 0x05, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xC5, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x25, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x00, 0x00, 0x54, 0x55, 0x00, 0x00, 0x55, 0x01, 0x55,
+    0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x01, 0x00, 0x55,
+    0x55, 0x00, 0x54, 0x00, 0x00, 0x50, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF7, 0xFF, 0xC7,
+    0xFF, 0xFD, 0xFF, 0x55, 0x55, 0xFF, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x7F, 0xF7, 0xFF, 0x27, 0xFF, 0xFD, 0xFF, 0x55, 0x55, 0xFF, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF7, 0xFF, 0xA7, 0xFC, 0xFD, 0xFF, 0x55, 0x55, 0xFF, 0x57, 0xFF,
+    0xFF, 0x5F, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0xF2, 0x01, 0x00, 0x55,
+    0x55, 0x00, 0x54, 0x00, 0x00, 0x50, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x6A, 0xA6, 0xAA, 0xA6,
+    0xCA, 0xA9, 0xAA, 0x55, 0x55, 0xAA, 0x56, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x6A, 0xA6, 0xAA, 0xA6, 0x2A, 0xA9, 0xAA, 0x55, 0x55, 0xAA, 0x56, 0xAA, 0xAA, 0x5A, 0x55, 0x55,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x55, 0x00, 0x00, 0x55, 0x55, 0x00, 0x54, 0x00,
+    0x00, 0x50, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x15, 0x40, 0x55, 0x01, 0x00, 0x50, 0x55, 0x00,
+    0x00, 0x55, 0x01, 0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0xF0, 0x03,
+    0x00, 0xCC, 0xFF, 0x00, 0x00, 0xFF, 0x03, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x30, 0x30, 0xF0, 0x03, 0x00, 0x2C, 0xFF, 0x00, 0x00, 0xFF, 0x03, 0xFF, 0xFF, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x50, 0x01, 0x00, 0xA4, 0x54, 0x00, 0x00, 0x55, 0x01, 0x55,
+    0x55, 0x05, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x71, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55,
+    0x55, 0x55, 0x49, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0x05, 0x50, 0x55, 0x00, 0x00, 0x54, 0x15, 0x00, 0x00, 0x55, 0x01, 0x55, 0x55, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x50, 0x55, 0x01, 0x00, 0x54, 0x55, 0x00, 0x54, 0x00,
+    0x00, 0x50, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0C, 0x00, 0x0C, 0x00, 0x03, 0x00, 0xF3,
+    0xFF, 0x00, 0xFC, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0C, 0x00, 0x0C,
+    0x00, 0x03, 0x00, 0xCB, 0xFF, 0x00, 0xFC, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC0, 0x0C, 0x00, 0x0C, 0x00, 0x03, 0x00, 0x2B, 0xFF, 0x00, 0xFC, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x04, 0x00, 0x01, 0x00, 0xA9, 0x7C, 0x00, 0x54, 0x00,
+    0x00, 0x50, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x08, 0x00, 0x08, 0x00, 0x02, 0x00, 0xAA,
+    0xB2, 0x00, 0xA8, 0x00, 0x00, 0xA0, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x08, 0x00, 0x08,
+    0x00, 0x02, 0x00, 0xAA, 0x8A, 0x00, 0xA8, 0x00, 0x00, 0xA0, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x01, 0x00, 0x54, 0x55, 0x00, 0x00, 0x55, 0x15, 0x00, 0x54, 0x00, 0x00, 0x50, 0x55, 0x55,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0x05, 0x00, 0x40, 0x15, 0x40, 0x55, 0x01, 0x00, 0x50, 0x55, 0x00, 0x00, 0x54, 0x01, 0x55,
+    0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x10, 0x10, 0x10, 0x50, 0x01, 0x00, 0x04, 0x54, 0x00,
+    0x00, 0x51, 0x01, 0x55, 0x55, 0x05, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55,
+    0x55, 0x55, 0x41, 0x55, 0x55, 0xC5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x41, 0x55, 0x55, 0x25, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x54, 0x01, 0x00, 0x50, 0x05, 0x50, 0x55, 0x00, 0x00, 0x54, 0x15, 0x00, 0x00, 0x55, 0x00, 0x55,
+    0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x05, 0x00, 0x05, 0x00, 0x50, 0x55, 0x01, 0x00, 0x54,
+    0x55, 0x00, 0x50, 0x00, 0x00, 0x50, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x45, 0x05, 0x40, 0x04, 0x00, 0x04,
+    0x00, 0x01, 0x00, 0x01, 0x40, 0x00, 0x44, 0x00, 0x00, 0x50, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x15, 0x00,
+    0x40, 0x01, 0x00, 0x54, 0x55, 0x00, 0x00, 0x55, 0x15, 0x00, 0x14, 0x00, 0x00, 0x50, 0x55, 0x55,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xF0, 0x0F, 0x00, 0xC0, 0x3F, 0xC0, 0xFF, 0x03, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0xFC, 0x03, 0xFC,
+    0xFF, 0x0F, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFA, 0xFF,
+    0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xEF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF,
+    0xFF, 0xFE, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xAF, 0xFE, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xEF, 0xFF, 0xEF, 0xFF, 0xFF,
+    0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xCA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xEF,
+    0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x2A, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0C,
+    0x08, 0x0C, 0x00, 0x20, 0x30, 0x20, 0xF0, 0x03, 0x00, 0x08, 0xFC, 0x00, 0x00, 0xF2, 0x03, 0xAA,
+    0xFC, 0x0F, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xFA, 0xFF, 0xAA, 0xAF, 0xAA, 0xAA, 0xAA, 0xFE, 0xBF,
+    0xEA, 0xAB, 0xAA, 0xEA, 0xBF, 0xAA, 0xAA, 0xAA, 0xFF, 0xAB, 0xBE, 0xAA, 0xAA, 0xAA, 0xFA, 0xFF,
+    0xEA, 0xAA, 0xEA, 0xAB, 0xAF, 0xAA, 0xAA, 0xFE, 0xFF, 0xEB, 0xAB, 0xAA, 0xAF, 0xAF, 0xAA, 0xEA,
+    0xFF, 0xFF, 0xBF, 0xFE, 0xAB, 0xFE, 0xFF, 0xAF, 0xFA, 0xAF, 0xFA, 0xFF, 0xFF, 0xAB, 0xFE, 0xFF,
+    0xFF, 0xFA, 0xFF, 0xAA, 0xF2, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xFE, 0xFF, 0xAA, 0xAF, 0xAA,
+    0xAA, 0xAA, 0xFF, 0xBF, 0xEA, 0xAB, 0xAA, 0xEA, 0xBF, 0xAA, 0xAA, 0xEA, 0xFF, 0xAB, 0xBE, 0xAA,
+    0xAA, 0xAA, 0xFE, 0xFF, 0xEA, 0xAA, 0xFA, 0xAB, 0xAF, 0xAA, 0xAA, 0xFE, 0xFF, 0xEB, 0xAB, 0xEA,
+    0xAF, 0xAF, 0xAA, 0xFA, 0xFF, 0xFF, 0xBF, 0xFE, 0xAB, 0xFE, 0xFF, 0xAF, 0xFA, 0xAF, 0x0A, 0xFF,
+    0xFF, 0xAB, 0xC2, 0xFF, 0xFF, 0x0A, 0xFF, 0xAA, 0xCA, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xFF,
+    0xFF, 0xAA, 0xAF, 0xAA, 0xAA, 0xEA, 0xFF, 0xBF, 0xFA, 0xAB, 0xEA, 0xFF, 0xBF, 0xAA, 0xEA, 0xFF,
+    0xFF, 0xEB, 0xBF, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFB, 0xAF, 0xAA, 0xFE, 0xFF,
+    0xFF, 0xFB, 0xFB, 0xFF, 0xEF, 0xAF, 0xAA, 0xFE, 0xFF, 0xFF, 0xBF, 0xFE, 0xAB, 0xFE, 0xFF, 0xAF,
+    0xFA, 0xAF, 0x0A, 0xFF, 0xFF, 0xAB, 0xC2, 0xFF, 0xFF, 0x0A, 0xFF, 0xAA, 0x2A, 0xFF, 0xFF, 0xFF,
+    0xAA, 0xAA, 0xEA, 0xFF, 0xFF, 0xAA, 0xAF, 0xAA, 0xAA, 0xFA, 0xFF, 0xBF, 0xFA, 0xAB, 0xFA, 0xFF,
+    0xBF, 0xAA, 0xFA, 0xFF, 0xFF, 0xEB, 0xBF, 0xAA, 0xEA, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFB,
+    0xAF, 0xAA, 0xFF, 0xFF, 0xFF, 0xFB, 0xFB, 0xFF, 0xEF, 0xAF, 0xAA, 0xFF, 0xFF, 0xFF, 0xBF, 0xFE,
+    0xAB, 0xFE, 0xFF, 0xAF, 0xFA, 0xAF, 0xAA, 0xFF, 0xFF, 0xAB, 0xEA, 0xFF, 0xFF, 0xAA, 0xFF, 0xAA,
+    0xAA, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x02, 0xA8, 0x02, 0x00, 0xA0, 0x0A, 0xA0, 0xAA, 0x00, 0x00, 0xA8, 0x2A, 0x00,
+    0x00, 0xAA, 0x00, 0xAA, 0xAA, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0xF0,
+    0xFF, 0x03, 0x00, 0xFC, 0xFF, 0x00, 0xF0, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFA, 0xBF, 0xEA, 0xAB, 0xAA, 0xFA, 0xAF,
+    0xAA, 0xAF, 0xAA, 0xFA, 0xFF, 0xAB, 0xAA, 0xFE, 0xFF, 0xAA, 0xFA, 0xAA, 0xAA, 0x2A, 0xFF, 0xFF,
+    0xAA, 0xAA, 0xFE, 0xFF, 0xFF, 0xFA, 0xAF, 0xAA, 0xEA, 0xFF, 0xFF, 0xBF, 0xFA, 0xAB, 0xAA, 0xFA,
+    0xBF, 0xAA, 0xAA, 0xFA, 0xFF, 0xAB, 0xBE, 0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA, 0xAB,
+    0xAE, 0xAA, 0xAA, 0xEA, 0xFF, 0xAB, 0xAB, 0xAA, 0xAE, 0xAE, 0xAA, 0xAA, 0xAA, 0xFE, 0xBF, 0xEA,
+    0xAB, 0xAA, 0xFA, 0xAF, 0xAA, 0xAF, 0xAA, 0xFA, 0xFF, 0xAB, 0xAA, 0xFE, 0xFF, 0xAA, 0xFA, 0xAA,
+    0xAA, 0xAA, 0xFC, 0xFF, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0xFA, 0xAF, 0xAA, 0xFA, 0xFF, 0xFF, 0xBF,
+    0xFA, 0xAB, 0xAA, 0xFE, 0xBF, 0xAA, 0xAA, 0xFE, 0xFF, 0xAB, 0xBE, 0xAA, 0xAA, 0xEA, 0xFF, 0xFF,
+    0xEA, 0xAA, 0xAA, 0xAB, 0xAE, 0xAA, 0xAA, 0xFA, 0xFF, 0xAB, 0xAB, 0xAA, 0xAE, 0xAE, 0xAA, 0xAA,
+    0xAA, 0xFF, 0xBF, 0xEA, 0xAB, 0xAA, 0xFA, 0xAF, 0xAA, 0xAF, 0xAA, 0xFA, 0xFF, 0xAB, 0xAA, 0xFE,
+    0xFF, 0xAA, 0xFA, 0xAA, 0xAA, 0xAA, 0xF2, 0xFF, 0xAA, 0xEA, 0xFF, 0xFF, 0xFF, 0xFA, 0xAF, 0xAA,
+    0xFE, 0xFF, 0xFF, 0xBF, 0xFE, 0xAB, 0xFE, 0xFF, 0xBF, 0xAA, 0xFE, 0xFF, 0xFF, 0xEB, 0xBF, 0xAA,
+    0xFA, 0xFF, 0xFF, 0xFF, 0xFE, 0xEA, 0xFF, 0xEB, 0xAF, 0xAA, 0xFA, 0xFF, 0xFF, 0xEB, 0xAB, 0xFF,
+    0xAF, 0xAF, 0xAA, 0xAA, 0xEA, 0xFF, 0xBF, 0xEA, 0xAB, 0xAA, 0xFA, 0xAF, 0xAA, 0xAF, 0xAA, 0xFA,
+    0xFF, 0xAB, 0xAA, 0xFE, 0xFF, 0xAA, 0xFA, 0xAA, 0xAA, 0xAA, 0xCA, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x03, 0xA0, 0xCA, 0x0F,
+    0x80, 0x0C, 0x00, 0x08, 0x00, 0x03, 0x00, 0x02, 0xC0, 0x00, 0xC8, 0x00, 0x00, 0xA0, 0x2A, 0xFF,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xBA, 0xAA,
+    0xAB, 0xAA, 0xEA, 0xAF, 0xAA, 0xAE, 0xAA, 0xAA, 0xAA, 0xAB, 0xAA, 0xAA, 0xEA, 0xAA, 0xEA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xBE, 0xAA, 0xAB, 0xAA, 0xEA, 0xAF, 0xAA, 0xAE, 0xAA, 0xAA, 0xAA, 0xAB, 0xAA, 0xAA,
+    0xEA, 0xAA, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xF2, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xBF, 0xAA, 0xAB, 0xAA, 0xEA, 0xAF, 0xAA, 0xAE, 0xAA, 0xAA,
+    0xAA, 0xAB, 0xAA, 0xAA, 0xEA, 0xAA, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xCA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0xA0, 0x2A, 0x00,
+    0x80, 0x02, 0x00, 0xA8, 0xAA, 0x00, 0x00, 0xAA, 0x2A, 0x00, 0x28, 0x00, 0x00, 0xA0, 0xAA, 0x2A,
+};
+
+// clang-format on
+
+#endif
\ No newline at end of file
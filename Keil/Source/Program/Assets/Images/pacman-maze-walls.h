@@ -0,0 +1,83 @@
+// This table was auto-generated by maze2walls.py. Do not edit it manually.
+#ifndef __PACMAN_BASEMAZE_WALLS_H
+#define __PACMAN_BASEMAZE_WALLS_H
+
+#include "pacman_types.h"
+
+// Wall cells: 279, merged into 68 rectangles that don't overlap.
+#define PACMAN_BASEMAZE_WALL_RECTS 68
+
+// clang-format off
+const PM_MazeRect PACMAN_BaseMazeWalls[PACMAN_BASEMAZE_WALL_RECTS] = {
+    {0, 0, 1, 23},
+    {1, 0, 9, 1},
+    {1, 11, 2, 1},
+    {1, 22, 9, 1},
+    {2, 2, 1, 4},
+    {2, 7, 1, 3},
+    {2, 13, 1, 3},
+    {2, 17, 1, 4},
+    {4, 2, 1, 4},
+    {4, 7, 2, 1},
+    {4, 9, 1, 5},
+    {4, 15, 2, 1},
+    {4, 17, 1, 4},
+    {5, 2, 1, 2},
+    {5, 11, 3, 1},
+    {5, 19, 1, 2},
+    {6, 5, 1, 1},
+    {6, 17, 1, 1},
+    {7, 2, 1, 4},
+    {7, 7, 1, 3},
+    {7, 13, 1, 3},
+    {7, 17, 1, 4},
+    {9, 1, 1, 5},
+    {9, 7, 1, 3},
+    {9, 11, 1, 1},
+    {9, 13, 1, 3},
+    {9, 17, 1, 5},
+    {10, 5, 1, 1},
+    {10, 7, 2, 1},
+    {10, 15, 2, 1},
+    {10, 17, 1, 1},
+    {11, 0, 1, 6},
+    {11, 9, 1, 2},
+    {11, 12, 1, 2},
+    {11, 17, 1, 6},
+    {12, 9, 1, 1},
+    {12, 13, 1, 1},
+    {13, 0, 1, 6},
+    {13, 7, 3, 1},
+    {13, 9, 1, 5},
+    {13, 15, 3, 1},
+    {13, 17, 1, 6},
+    {14, 5, 1, 1},
+    {14, 17, 1, 1},
+    {15, 0, 9, 1},
+    {15, 1, 1, 5},
+    {15, 9, 1, 5},
+    {15, 17, 1, 5},
+    {15, 22, 9, 1},
+    {17, 2, 6, 1},
+    {17, 3, 1, 2},
+    {17, 6, 6, 1},
+    {17, 7, 1, 2},
+    {17, 9, 6, 1},
+    {17, 11, 7, 1},
+    {17, 13, 1, 4},
+    {17, 18, 1, 3},
+    {18, 16, 1, 1},
+    {18, 18, 2, 1},
+    {19, 7, 1, 2},
+    {19, 13, 1, 4},
+    {19, 19, 1, 1},
+    {19, 20, 4, 1},
+    {20, 13, 2, 1},
+    {22, 3, 1, 2},
+    {22, 13, 1, 4},
+    {22, 18, 1, 2},
+    {24, 0, 1, 23},
+};
+// clang-format on
+
+#endif
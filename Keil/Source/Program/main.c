@@ -2,6 +2,8 @@
 #include "peripherals.h"
 #include "system.h"
 
+#include "LPC17xx.h"
+
 int main(void)
 {
     SystemInit();
@@ -9,7 +11,19 @@ int main(void)
     PACMAN_Init();
     PACMAN_Play(PM_SPEED_NORMAL);
 
-    POWER_Init(POWR_CFG_SLEEP_ON_EXIT);
+    // Sleeping between the frames. Not on exit from the ISRs: the game runs here, in thread mode.
+    POWER_Init(0);
     POWER_SleepOnWFI();
-    POWER_WaitForInterrupts();
+
+    while (true)
+    {
+        // The interrupts are masked between the check and the WFI, otherwise a tick coming in between would
+        // be simulated a tick late. The WFI still wakes up on a masked interrupt, served once unmasked.
+        __disable_irq();
+        if (!PACMAN_HasPendingTicks())
+            POWER_WaitForInterrupts();
+        __enable_irq();
+
+        PACMAN_Update();
+    }
 }
@@ -1,9 +1,12 @@
 #include "pacman.h"
+#include "pacman_core.h"
+#include "pacman_hud.h"
+#include "pacman_replay.h"
+#include "pacman_sprite.h"
 #include "allocator.h"
 #include "peripherals.h"
 
-#include "cl_list.h"
-#include "cl_prioqueue.h"
+#include "LPC17xx.h"
 
 #include <stdio.h>
 
@@ -14,7 +17,7 @@
 // Images
 #include "Assets/Images/pacman-life.h"
 #include "Assets/Images/pacman-logo.h"
-#include "Assets/Images/pacman-maze.h"
+#include "Assets/Images/pacman-maze-walls.h"
 #include "Assets/Images/pacman-sad.h"
 #include "Assets/Images/pacman-victory.h"
 
@@ -26,13 +29,57 @@
 
 // clang-format off
 enum Anchor { ANC_TOP_LEFT, ANC_CENTER };
+// From the bottom one to the top one: a sprite for each ghost, from SPRITE_GHOST on.
+enum Sprite { SPRITE_PACMAN, SPRITE_GHOST, SPRITE_COUNT = SPRITE_GHOST + PM_GHOST_COUNT };
+enum GhostFrame { GHOST_FRAME_CHASING, GHOST_FRAME_SCARED, GHOST_FRAME_COUNT };
+// clang-format on
+
+typedef struct
+{
+    LCD_ObjID titles, lives[MAX_LIVES];
+} PM_GameStatIDs;
+
+// What's drawn of the game in the core: the objects on the screen, and the strings they show.
+typedef struct
+{
+    LCD_Coordinate maze_pos;
+    PM_Sprite sprites[SPRITE_COUNT];
+    PM_GameStatIDs stat_obj_ids;
+    PM_HudNumber score, record, game_over_in; // Bound to the stats of the core
+    u8 lives_shown;
+    u8 stats_elapsed; // Ticks since the stats were last redrawn
+    bool new_record;
+} GameView;
 
 // STATE VARIABLES
 
-_PRIVATE PM_Game sGame;
+_PRIVATE const PM_Game *sGame; // Owned by the core
+_PRIVATE GameView sView;
+_PRIVATE PM_Speed sSpeed;
 _PRIVATE LCD_ObjID sPauseID;
 _PRIVATE LCD_FontID sFont14, sFont20;
-_PRIVATE PM_MazeObj sCurrentMaze[PM_MAZE_SCALED_HEIGHT][PM_MAZE_SCALED_WIDTH];
+_PRIVATE u8 sDigitAdvance; // Width of the digit slots of the stats, in sFont14
+_PRIVATE PM_SpriteBitmap sPacManBitmap, sGhostFrames[GHOST_FRAME_COUNT];
+
+// The RIT handler only counts the ticks, and the joystick and the buttons only store the input:
+// the game runs in thread mode, in PACMAN_Update, so the LCD is never accessed from an interrupt.
+_PRIVATE volatile u32 sTicks;
+_PRIVATE volatile PM_MovementDir sInputDir;
+_PRIVATE volatile bool sPauseRequested;
+_PRIVATE volatile u32 sPauseTick; // Tick the last press of the pause button was taken on
+_PRIVATE u32 sTicksDone;
+_PRIVATE void (*sNextView)(void); // Set when the game is over, shown at the end of the frame
+_PRIVATE PM_FrameStats sFrameStats;
+
+// Direction last asked for with the joystick, and the tick it was first asked for on, held or not,
+// to measure the latency of the input once PacMan takes it.
+_PRIVATE volatile PM_MovementDir sAskedDir;
+_PRIVATE volatile u32 sAskedTick;
+_PRIVATE PM_InputStats sInputStats;
+
+// Recordings of the last games, the one being played included, in a ring.
+_PRIVATE PM_Replay sReplays[PM_REPLAY_HISTORY];
+_PRIVATE u8 sReplayHead, sReplayCount;
 
 // Memory manager for the game.
 _PRIVATE MEM_Allocator *sAllocator = NULL;
@@ -53,17 +100,78 @@ _PROTOTYPE_ONLY _PRIVATE void game_defeat(void);
 _PRIVATE inline LCD_Coordinate maze_cell_to_coords(PM_MazeCell cell, enum Anchor anchor)
 {
     return (LCD_Coordinate){
-        .x = sGame.maze_pos.x + (cell.col * PM_MAZE_CELL_SIZE) + (anchor == ANC_CENTER ? PM_MAZE_CELL_SIZE / 2 : 0),
-        .y = sGame.maze_pos.y + (cell.row * PM_MAZE_CELL_SIZE) + (anchor == ANC_CENTER ? PM_MAZE_CELL_SIZE / 2 : 0),
+        .x = sView.maze_pos.x + (cell.col * PM_MAZE_CELL_SIZE) + (anchor == ANC_CENTER ? PM_MAZE_CELL_SIZE / 2 : 0),
+        .y = sView.maze_pos.y + (cell.row * PM_MAZE_CELL_SIZE) + (anchor == ANC_CENTER ? PM_MAZE_CELL_SIZE / 2 : 0),
     };
 }
 
-_PRIVATE inline LCD_Coordinate maze_cell_to_coords_img(PM_MazeCell cell, const LCD_Image *const image, enum Anchor anchor)
+// Top-left corner of a sprite on its way from the cell it left to its cell, as far as the next step has been
+// gathered. A sprite that jumped, e.g. through a portal, or that stood still, is drawn in its cell.
+_PRIVATE LCD_Coordinate sprite_coords(PM_MazeCell from, PM_MazeCell to, u16 step_acc, const PM_SpriteBitmap *bitmap)
 {
-    return (LCD_Coordinate){
-        .x = sGame.maze_pos.x + (cell.col * PM_MAZE_CELL_SIZE) + (anchor == ANC_CENTER ? PM_MAZE_CELL_SIZE / 2 - image->width / 2 : 0),
-        .y = sGame.maze_pos.y + (cell.row * PM_MAZE_CELL_SIZE) + (anchor == ANC_CENTER ? PM_MAZE_CELL_SIZE / 2 - image->width / 2 : 0),
-    };
+    const i16 d_row = (i16)to.row - from.row, d_col = (i16)to.col - from.col;
+    const bool is_step = d_row * d_row + d_col * d_col == 1;
+
+    // The sprite moves by PM_SPRITE_STEP_PX at a time, rounded up past the fraction gathered. Once that's a
+    // whole cell, e.g. always with a step of a cell, it's drawn in its cell, where the core has it.
+    u16 offset = is_step ? (u32)step_acc * PM_MAZE_CELL_SIZE / PM_SPEED_STEP : PM_MAZE_CELL_SIZE;
+    offset += PM_SPRITE_STEP_PX - offset % PM_SPRITE_STEP_PX;
+    const bool in_cell = offset >= PM_MAZE_CELL_SIZE;
+
+    LCD_Coordinate pos = maze_cell_to_coords(in_cell ? to : from, ANC_CENTER);
+    pos.x -= bitmap->width / 2;
+    pos.y -= bitmap->height / 2;
+    if (in_cell)
+        return pos;
+
+    pos.x += d_col * offset;
+    pos.y += d_row * offset;
+    return pos;
+}
+
+// Color of the maze under the sprites: the pill of the cell, if there's one left, or the floor.
+_PRIVATE u16 maze_background(LCD_Coordinate point)
+{
+    const u16 x = point.x - sView.maze_pos.x, y = point.y - sView.maze_pos.y;
+    const u32 bit = PM_MAZE_BIT(x / PM_MAZE_CELL_SIZE);
+    const u16 row = y / PM_MAZE_CELL_SIZE;
+    const i16 dx = x % PM_MAZE_CELL_SIZE - PM_MAZE_CELL_SIZE / 2, dy = y % PM_MAZE_CELL_SIZE - PM_MAZE_CELL_SIZE / 2;
+    const u16 dist = dx * dx + dy * dy;
+
+    if ((sGame->maze.pills[row] & bit) && dist <= PM_STD_PILL_RADIUS * PM_STD_PILL_RADIUS)
+        return RGB8_TO_RGB565(PM_STD_PILL_COLOR);
+
+    if ((sGame->maze.super_pills[row] & bit) && dist <= PM_SUP_PILL_RADIUS * PM_SUP_PILL_RADIUS)
+        return RGB8_TO_RGB565(PM_SUP_PILL_COLOR);
+
+    return LCD_COL_BLACK;
+}
+
+// Draws the pill of a cell as it is in the maze, i.e. the one left, if any, or the floor. The pills are
+// not objects of the GLCD: they're drawn straight to the LCD from the bitboards, as the sprites are.
+// The pixels hidden by the sprites are skipped, the sprites show the maze through the others.
+// @param is_blank Whether the cell shows the floor only, e.g. since the screen has just been cleared.
+_PRIVATE void draw_maze_cell(PM_MazeCell cell, bool is_blank)
+{
+    const LCD_Coordinate center = maze_cell_to_coords(cell, ANC_CENTER);
+    LCD_Coordinate point;
+    u16 color;
+    for (i16 dy = -PM_SUP_PILL_RADIUS; dy <= PM_SUP_PILL_RADIUS; dy++)
+    {
+        for (i16 dx = -PM_SUP_PILL_RADIUS; dx <= PM_SUP_PILL_RADIUS; dx++)
+        {
+            // Farther from the center, there's always the floor.
+            if (dx * dx + dy * dy > PM_SUP_PILL_RADIUS * PM_SUP_PILL_RADIUS)
+                continue;
+
+            point = (LCD_Coordinate){center.x + dx, center.y + dy};
+            color = maze_background(point);
+            if ((is_blank && color == LCD_COL_BLACK) || PM_SpritesCover(sView.sprites, SPRITE_COUNT, point))
+                continue;
+
+            LCD_SetPointColor(color, point);
+        }
+    }
 }
 
 // VIEW DEFINITIONS
@@ -71,7 +179,7 @@ _PRIVATE inline LCD_Coordinate maze_cell_to_coords_img(PM_MazeCell cell, const L
 _PRIVATE void init_info(void)
 {
     // clang-format off
-    LCD_OBJECT(&sGame.stat_obj_ids.titles, {
+    LCD_OBJECT(&sView.stat_obj_ids.titles, {
         LCD_TEXT2(5, 5, {
             .text = "GAME OVER", .font = sFont14, .char_spacing = 2, 
             .text_color = LCD_COL_WHITE, .bg_color = LCD_COL_NONE,
@@ -89,29 +197,18 @@ _PRIVATE void init_info(void)
             .text_color = LCD_COL_WHITE, .bg_color = LCD_COL_NONE,
         }),
     });
+    // clang-format on
 
-    sprintf(sGame.stat_strings.score, "%d", sGame.stat_values.score);
-    sprintf(sGame.stat_strings.record, "%d", sGame.stat_values.record);
-    sprintf(sGame.stat_strings.game_over_in, "%d", sGame.stat_values.game_over_in);
-
-    LCD_OBJECT(&sGame.stat_obj_ids.game_over_in_value, {
-        LCD_TEXT2(5, 20, {
-            .text = sGame.stat_strings.game_over_in, .font = sFont14,
-            .char_spacing = 2, .text_color = sColorOrange, .bg_color = LCD_COL_NONE,
-        }),
-    });
-
-    LCD_OBJECT(&sGame.stat_obj_ids.score_record_values, {
-        LCD_TEXT2(LCD_GetWidth() / 2 - 10, 20, {
-            .text = sGame.stat_strings.score, .font = sFont14,
-            .char_spacing = 2, .text_color = sColorOrange, .bg_color = LCD_COL_NONE,
-        }),
-        LCD_TEXT2(LCD_GetWidth() - 60, 20, {
-            .text = sGame.stat_strings.record, .font = sFont14,
-            .char_spacing = 2, .text_color = sColorOrange, .bg_color = LCD_COL_NONE,
-        }),
-    });
+    // The values are drawn a digit at a time, so that only the digits that change are redrawn.
+    const PM_GameStatValues *const stats = &sGame->stat_values;
+    PM_HudNumberInit(&sView.game_over_in, stats->game_over_in, (LCD_Coordinate){5, 20}, sFont14, sDigitAdvance,
+                     sColorOrange);
+    PM_HudNumberInit(&sView.score, stats->score, (LCD_Coordinate){LCD_GetWidth() / 2 - 10, 20}, sFont14,
+                     sDigitAdvance, sColorOrange);
+    PM_HudNumberInit(&sView.record, stats->record, (LCD_Coordinate){LCD_GetWidth() - 60, 20}, sFont14, sDigitAdvance,
+                     sColorOrange);
 
+    // clang-format off
     // Defininig lives, which will be visible on manual control.
     LCD_Coordinate life_img_pos;
     for (u8 i = 0; i < MAX_LIVES; i++)
@@ -121,7 +218,7 @@ _PRIVATE void init_info(void)
             .y = LCD_GetHeight() - 28,
         };
 
-        LCD_INVISIBLE_OBJECT(&sGame.stat_obj_ids.lives[i], {
+        LCD_INVISIBLE_OBJECT(&sView.stat_obj_ids.lives[i], {
             LCD_IMAGE(life_img_pos, Image_PACMAN_Life),
         });
     }
@@ -129,7 +226,8 @@ _PRIVATE void init_info(void)
     // 1 life is always present
     // clang-format on
 
-    LCD_RMSetVisibility(sGame.stat_obj_ids.lives[0], true, false);
+    LCD_RMSetVisibility(sView.stat_obj_ids.lives[0], true, false);
+    sView.lives_shown = 1;
     LCD_RMRender();
 }
 
@@ -151,689 +249,221 @@ _PRIVATE void init_pause(void)
 
 _PRIVATE void draw_maze(void)
 {
-    PM_MazeObj obj;
-    PM_MazeCell obj_cell;
-    for (u16 row = 0; row < PM_MAZE_SCALED_HEIGHT; row++)
-    {
-        for (u16 col = 0; col < PM_MAZE_SCALED_WIDTH; col++)
-        {
-            obj = sCurrentMaze[row][col];
-            obj_cell = (PM_MazeCell){row, col};
-
-            // clang-format off
-            switch (obj)
-            {
-            case PM_WALL:
-                LCD_RENDER_TMP({
-                    LCD_RECT(maze_cell_to_coords(obj_cell, ANC_TOP_LEFT), {
-                        .width = PM_MAZE_CELL_SIZE, .height = PM_MAZE_CELL_SIZE,
-                        .fill_color = PM_WALL_COLOR, .edge_color = PM_WALL_COLOR,
-                    }),
-                });
-                break;
-            case PM_PILL:
-                LCD_OBJECT(&sGame.pill_ids[obj_cell.row][obj_cell.col],{
-                    LCD_CIRCLE({
-                        .center = maze_cell_to_coords(obj_cell, ANC_CENTER),
-                        .fill_color = PM_STD_PILL_COLOR,
-                        .edge_color = PM_STD_PILL_COLOR,
-                        .radius = PM_STD_PILL_RADIUS,
-                    }),
-                });
-                break;
-            case PM_PCMN:
-                LCD_OBJECT(&sGame.pacman.id, {
-                    LCD_CIRCLE({
-                        .center = maze_cell_to_coords(obj_cell, ANC_CENTER), .radius = PM_PACMAN_RADIUS,
-                        .fill_color = PM_PACMAN_COLOR, .edge_color = PM_PACMAN_COLOR
-                    }),
-                });
-                break;
-            default:
-                break;
-            }
-            // clang-format on
-        }
-    }
-
-    LCD_RMRender();
-}
-
-// POWER PILLS
+    const u32 start = DWT->CYCCNT;
 
-_PRIVATE inline bool super_pill_spawn_second_already_taken(u32 sec, u16 super_pills_arr_length)
-{
-    for (u8 i = 0; i < super_pills_arr_length; i++)
-        if (sGame.super_pills[i].spawn_sec == sec)
-            return true;
-
-    return false;
-}
-
-_PRIVATE void init_super_pills(void)
-{
-    // 6 Super pills need to be generated at random positions in the maze
-    // (i.e. we have to randomize the row & col values of the maze cells),
-    // and at random times (i.e. we have to randomize the time intervals
-    // between the generation of each power pill), till the end of the 60s.
-    PRNG_Set(PRNG_USE_AUTO_SEED);
-
-    u16 i = 0, row, col, spawn_sec = 0;
-    while (i < PM_SUP_PILL_COUNT)
+    // The walls come merged into rectangles at build time, which are drawn with a fill each instead
+    // of a fill per cell, see maze2walls.py. The GLCD draws a rectangle one pixel wider and taller
+    // than its size, so the cells used to rewrite the edges they share: the rectangles share fewer.
+    const PM_MazeRect *rect;
+    for (u16 i = 0; i < PACMAN_BASEMAZE_WALL_RECTS; i++)
     {
-        // Generate random position in maze
-        row = PRNG_Range(1, PM_MAZE_SCALED_HEIGHT - 1);
-        col = PRNG_Range(1, PM_MAZE_SCALED_WIDTH - 1);
-
-        // Checking if the cell is not a wall, another power pill, PacMan,
-        // a teleport, or a ghost. If it is, we need to generate another one.
-        if (sCurrentMaze[row][col] != PM_PILL)
-            continue;
-
-        sGame.super_pills[i].cell = (PM_MazeCell){row, col};
+        rect = &PACMAN_BaseMazeWalls[i];
 
         // clang-format off
-        LCD_INVISIBLE_OBJECT(&sGame.super_pills[i].id, {
-            LCD_CIRCLE({
-                .center = maze_cell_to_coords(sGame.super_pills[i].cell, ANC_CENTER),
-                .fill_color = PM_SUP_PILL_COLOR,
-                .edge_color = PM_SUP_PILL_COLOR,
-                .radius = PM_SUP_PILL_RADIUS,
+        LCD_RENDER_TMP({
+            LCD_RECT(maze_cell_to_coords((PM_MazeCell){rect->row, rect->col}, ANC_TOP_LEFT), {
+                .width = rect->width * PM_MAZE_CELL_SIZE, .height = rect->height * PM_MAZE_CELL_SIZE,
+                .fill_color = PM_WALL_COLOR, .edge_color = PM_WALL_COLOR,
             }),
         });
         // clang-format on
-
-        // Generate random times for the power pills to spawn
-        do
-        {
-            spawn_sec = PRNG_Range(5, 59);
-        } while (super_pill_spawn_second_already_taken(spawn_sec, i));
-
-        sGame.super_pills[i].spawn_sec = spawn_sec;
-        i++;
     }
 
-    PRNG_Release();
+    // Walking through the set bits of each row, lowest column first. The super pills are drawn once
+    // they spawn, since they're not in the maze before.
+    u32 bits;
+    for (u16 row = 0; row < PM_MAZE_SCALED_HEIGHT; row++)
+        for (bits = sGame->maze.pills[row] | sGame->maze.super_pills[row]; bits; bits &= bits - 1)
+            draw_maze_cell((PM_MazeCell){row, __builtin_ctz(bits)}, true);
+
+    sFrameStats.maze_cycles = DWT->CYCCNT - start;
 }
 
-// GHOSTS
+// SPRITES
 
-typedef struct AStarNode
+// PacMan and the ghosts are not drawn yet: draw_actors draws them, once the maze is drawn.
+_PRIVATE void init_sprites(void)
 {
-    PM_MazeCell cell;
-    // f = g + h
-    // g = cost to reach the cell from the start
-    // h = heuristic function (Manhattan distance in this case)
-    u16 f, g, h;
-    struct AStarNode *parent; // Used to reconstruct the path
-} AStarNode;
-
-// Comparison function for the priority queue in the A* algorithm.
-_COMPARE_FN(compare_f_values, a, b, {
-    // a and b point to pointers to AStarNode
-    const AStarNode *nodeA = *(const AStarNode **)a;
-    const AStarNode *nodeB = *(const AStarNode **)b;
-    return (int)nodeA->f - (int)nodeB->f;
-});
-
-// Using the Manhattan distance as the heuristic function for the A* algorithm.
-// The Manhattan distance is the sum of the absolute differences of the x and y
-// coordinates of the two points. It is a good heuristic for this game, since
-// the ghosts can only move in 4 directions, and the maze is a grid.
-_PRIVATE inline u16 heuristic(PM_MazeCell a, PM_MazeCell b)
-{
-    return abs(a.row - b.row) + abs(a.col - b.col);
+    PM_SpriteInit(&sView.sprites[SPRITE_PACMAN], &sPacManBitmap, 1);
+    for (u8 i = 0; i < PM_GHOST_COUNT; i++)
+        PM_SpriteInit(&sView.sprites[SPRITE_GHOST + i], sGhostFrames, GHOST_FRAME_COUNT);
 }
 
-// Generates the neighbors of a cell in the maze, paying attention to the maze boundaries (e.g. walls).
-_PRIVATE void neighbors_finder(PM_MazeCell cell, PM_MazeCell *out_neighbors_arr, u8 *out_neighbors_sz)
-{
-    PM_MazeCell neighbors[] = {
-        {cell.row - 1, cell.col}, // Up
-        {cell.row + 1, cell.col}, // Down
-        {cell.row, cell.col - 1}, // Left
-        {cell.row, cell.col + 1}, // Right
-    };
-
-    // Ensuring the neighbors are within the maze boundaries and not walls.
-    *out_neighbors_sz = 0;
-    PM_MazeCell *neighbor;
-    PM_MazeObj obj;
-    for (u8 i = 0; i < 4; i++)
-    {
-        neighbor = &neighbors[i];
-
-        // If the row or column is out of bounds, we skip this neighbor.
-        if (!IS_BETWEEN_EQ(neighbor->row, 0, PM_MAZE_SCALED_HEIGHT - 1) ||
-            !IS_BETWEEN_EQ(neighbor->col, 0, PM_MAZE_SCALED_WIDTH - 1))
-            continue;
+// STATS
 
-        // If the cell is a pill, a super pill, or none, we can move there.
-        obj = sCurrentMaze[neighbor->row][neighbor->col];
-        if (obj == PM_WALL || obj == PM_LTPL || obj == PM_RTPL)
-            continue; // Walls and teleporters are not valid neighbors.
+// Shows an icon per life, if the lives changed.
+_PRIVATE void update_lives(void)
+{
+    for (; sView.lives_shown < sGame->stat_values.lives && sView.lives_shown < MAX_LIVES; sView.lives_shown++)
+        LCD_RMSetVisibility(sView.stat_obj_ids.lives[sView.lives_shown], true, false);
 
-        out_neighbors_arr[*out_neighbors_sz] = *neighbor;
-        (*out_neighbors_sz)++;
-    }
+    for (; sView.lives_shown > sGame->stat_values.lives; sView.lives_shown--)
+        LCD_RMSetVisibility(sView.stat_obj_ids.lives[sView.lives_shown - 1], false, false);
 }
 
-// Once we dequeue the goal cell from the open set, we can reconstruct the path
-// to the star cell by backtracking using the parent pointers of each node.
-_PRIVATE CL_List *reconstruct_path(AStarNode *const goal)
+// Nothing is redrawn unless a value differs from the one shown.
+_PRIVATE void update_stats(void)
 {
-    // Reconstructing the path from the goal cell to the start cell.
-    CL_List *const path_list = CL_ListAlloc(sAllocator, sizeof(PM_MazeCell));
-    if (!path_list)
-        return NULL;
-
-    AStarNode *current_node = goal;
-    while (current_node)
-    {
-        CL_ListPushFront(path_list, &(current_node->cell));
-        current_node = current_node->parent;
-    }
-
-    return path_list;
+    PM_HudNumberSet(&sView.score, sGame->stat_values.score);
+    PM_HudNumberSet(&sView.record, sGame->stat_values.record);
+    update_lives();
 }
 
-/*
-Using the A* algorithm to find the shortest path from the ghost to the goal cell. A* selects the path
-that minimizes the cost function f = g + h, where g is the cost to reach the cell from the start,
-and h is the heuristic function (in this case, the Manhattan distance), that estimates the cost
-to reach the goal from the current cell.
-
-The algorithm uses two lists:
-    - Open list: Contains the cell that  need to be evaluated. Initially, it only contains the start cell.
-    - Closed list: Contains the cells that have already been evaluated. Initially, it is empty.
-
-The open list is implemented as a priority queue, where the cell having the smallest f value has the
-highest priority, thus it will be dequeued first. The algorithm finishes when:
-    - The open list is empty
-    - The goal cell is added to the closed list.
-
-If the former happens (and not the latter), it means that there's no path to the goal cell from the
-starting point; if the latter happens, the path has been found, and we can backtrack from the goal
-cell to the start cell to reconstruct the path.
-*/
-_PRIVATE CL_List *find_path_to_goal(PM_MazeCell start, PM_MazeCell goal)
+_PRIVATE void show_pause(void)
 {
-    CL_PQueue *const open_set = CL_PQueueAlloc(sAllocator, sizeof(AStarNode *), compare_f_values);
-    if (!open_set)
-        return NULL;
-
-    // Visited cells array to keep track of the cells that have already been evaluated.
-    static bool visited_cells[PM_MAZE_SCALED_HEIGHT][PM_MAZE_SCALED_WIDTH];
-    memset(visited_cells, 0, sizeof(visited_cells));
-
-    // Array of AStarNodes for each cell in the maze.
-    static AStarNode nodes[PM_MAZE_SCALED_HEIGHT][PM_MAZE_SCALED_WIDTH];
-    memset(nodes, 0, sizeof(nodes));
-
-    // Filling the start node with the initial values.
-    const u16 heuristic_value = heuristic(start, goal); // Heuristic function (Manhattan distance)
-    AStarNode *const start_node = &nodes[start.row][start.col];
-    *start_node = (AStarNode){start, heuristic_value, 0, heuristic_value, NULL};
-    CL_PQueueEnqueue(open_set, &start_node);
-
-    // Iterating while the open set is not empty.
-    AStarNode *cur_node, *neigh_node;
-    PM_MazeCell neighs[4], *neigh_cell;
-    u8 neigh_count;
-    u16 new_g;
-    bool not_visited;
-    while (!CL_PQueueIsEmpty(open_set))
+    // Toggling between playing or paused views. The pause view
+    // is located at the same place as the stats, so we don't need to delete/draw
+    // the maze (it is always visible, just not controllable during pause).
+    const bool playing_now = sGame->playing_now;
+    if (playing_now)
     {
-        // Retrieving the cell with the lowest f value from the open set.
-        CL_PQueueDequeue(open_set, &cur_node);
-
-        // Checking if the current cell is in the closed set, meaning that it has been evaluated.
-        if (visited_cells[cur_node->cell.row][cur_node->cell.col])
-            continue;
-
-        // If not the goal, add the current cell to the closed set.
-        visited_cells[cur_node->cell.row][cur_node->cell.col] = true;
-
-        // Checking if the current cell is the goal cell.
-        if (cur_node->cell.row == goal.row && cur_node->cell.col == goal.col)
-        {
-            CL_List *const path = reconstruct_path(cur_node);
-            CL_PQueueFree(open_set);
-            return path;
-        }
+        LCD_RMSetVisibility(sPauseID, false, false);
+        JOYSTICK_EnableAction(JOY_ACTION_ALL);
+    }
 
-        // If the current cell is not the goal cell, we need to find its neighbors.
-        neighbors_finder(cur_node->cell, neighs, &neigh_count);
-        for (u8 i = 0; i < neigh_count; i++)
-        {
-            neigh_cell = &neighs[i];
+    LCD_RMSetVisibility(sView.stat_obj_ids.titles, playing_now, false);
+    PM_HudNumberSetVisibility(&sView.score, playing_now);
+    PM_HudNumberSetVisibility(&sView.record, playing_now);
+    PM_HudNumberSetVisibility(&sView.game_over_in, playing_now);
 
-            // Checking if the neighbor is in the closed set
-            if (visited_cells[neigh_cell->row][neigh_cell->col])
-                continue;
+    // Handling lives
+    for (u8 i = 0; i < sView.lives_shown; i++)
+        LCD_RMSetVisibility(sView.stat_obj_ids.lives[i], playing_now, false);
 
-            new_g = cur_node->g + 1; // The cost to move from one cell to its neighbor is always 1.
-
-            // If the neighbor has g = 0 and it's not the start cell, OR the new g < current g => update.
-            neigh_node = &nodes[neigh_cell->row][neigh_cell->col];
-            not_visited = !neigh_node->g && (neigh_node->cell.row != start.row || neigh_node->cell.col != start.col);
-            if (not_visited || new_g < neigh_node->g)
-            {
-                neigh_node->cell = *neigh_cell;
-                neigh_node->g = new_g;
-                neigh_node->h = heuristic(*neigh_cell, goal);
-                neigh_node->f = new_g + neigh_node->h;
-                neigh_node->parent = cur_node;
-                CL_PQueueEnqueue(open_set, &neigh_node);
-            }
-        }
+    // If paused, we set the pause view visible after we've done hiding the playing views,
+    // otherwise we would have overlapping.
+    if (!playing_now)
+    {
+        LCD_RMSetVisibility(sPauseID, true, false);
+        JOYSTICK_DisableAction(JOY_ACTION_ALL);
     }
-
-    CL_PQueueFree(open_set);
-    return NULL;
 }
 
-_PRIVATE void init_ghost(bool scared)
-{
-    PM_MazeObj obj;
-    PM_MazeCell cell;
-    LCD_Coordinate coords;
-    for (u8 i = 0; i < PM_MAZE_SCALED_HEIGHT; i++)
-    {
-        for (u8 j = 0; j < PM_MAZE_SCALED_WIDTH; j++)
-        {
-            obj = sCurrentMaze[i][j];
-            if (obj != PM_GHSR)
-                continue;
-
-            cell = (PM_MazeCell){i, j};
-            sGame.ghost.cell = cell;
+// EVENTS
 
-            // clang-format off
-            const LCD_Image img = scared ? Image_PACMAN_YellowGhost : Image_PACMAN_RedGhost;
-            coords = maze_cell_to_coords_img(cell, &img, ANC_CENTER);
-            LCD_OBJECT(&sGame.ghost.id, {
-                LCD_IMAGE(coords, img),
-            });
-            // clang-format on
-
-            LCD_RMRender();
+// Brings the screen up to date with the events of a tick. PacMan and the ghost are moved at the end
+// of the frame instead, by draw_actors, since a frame may simulate more than one tick.
+_PRIVATE void apply_events(const PM_Events *const events)
+{
+    if (events->flags & PM_EVT_PAUSE_TOGGLED)
+        show_pause();
 
-            return;
-        }
-    }
-}
+    // PacMan is drawn over the pill eaten, hence most of the time there's nothing left to clear.
+    if (events->flags & (PM_EVT_PILL_EATEN | PM_EVT_SUPER_PILL_EATEN))
+        draw_maze_cell(events->pill_cell, false);
 
-_PRIVATE PM_MazeCell find_farthest_cell_from_pacman(PM_MazeCell pacman)
-{
-    PM_MazeCell farthest_cell;
-    u16 record = 0, distance;
-    for (u16 i = 0; i < PM_MAZE_SCALED_HEIGHT; i++)
+    // The ghosts change color on the next frame, along with their move: only the pixels of their
+    // bounding boxes that differ between the two looks are rewritten. A ghost eaten comes back calmed down.
+    if (events->flags & (PM_EVT_GHOST_SCARED | PM_EVT_GHOST_CALMED | PM_EVT_GHOST_EATEN))
     {
-        for (u16 j = 0; j < PM_MAZE_SCALED_WIDTH; j++)
+        for (u8 i = 0; i < PM_GHOST_COUNT; i++)
         {
-            if (sCurrentMaze[i][j] == PM_WALL || sCurrentMaze[i][j] == PM_LTPL || sCurrentMaze[i][j] == PM_RTPL)
-                continue;
-
-            distance = abs(i - pacman.row) + abs(j - pacman.col);
-            if (distance > record)
-            {
-                record = distance;
-                farthest_cell = (PM_MazeCell){i, j};
-            }
+            const enum GhostFrame frame = sGame->ghosts[i].is_scared ? GHOST_FRAME_SCARED : GHOST_FRAME_CHASING;
+            PM_SpriteSetFrame(&sView.sprites[SPRITE_GHOST + i], frame);
         }
     }
 
-    return farthest_cell;
-}
+    // The icon of the life lost goes at once, instead of with the next stats update. PacMan and the ghosts
+    // are back on their spawn cells, where draw_actors moves their sprites at the end of the frame.
+    if (events->flags & PM_EVT_LIFE_LOST)
+        update_lives();
 
-// GHOST CALLBACKS
+    if (events->flags & PM_EVT_SECOND_ELAPSED)
+        PM_HudNumberSet(&sView.game_over_in, sGame->stat_values.game_over_in);
 
-_PRIVATE _CBACK void red_ghost_ai(void)
-{
-    // If the game is not playing, we don't need to move the ghost.
-    if (!sGame.playing_now)
-        return;
-
-    PM_Ghost *const ghost = &sGame.ghost;
-
-    // If the path is not valid, we need to recalculate it.
-    if (!ghost->path.is_valid || !ghost->path.path || CL_ListSize(ghost->path.path) < 5)
+    // The super pill replaces the standard pill in its cell, if it's still there.
+    if (events->flags & PM_EVT_SUPER_PILL_SPAWNED)
     {
-        if (ghost->path.path)
-            CL_ListFree(ghost->path.path);
-
-        // Recalculating the path to PacMan, or to the farthest cell from Pacman if he's scared.
-        PM_MazeCell goal =
-            sGame.ghost.is_scared ? find_farthest_cell_from_pacman(sGame.pacman.cell) : sGame.pacman.cell;
-
-        ghost->path.path = find_path_to_goal(ghost->cell, goal);
-        ghost->path.is_valid = (ghost->path.path && !CL_ListIsEmpty(ghost->path.path));
+        draw_maze_cell(sGame->super_pills[events->spawned_super_pill].cell, false);
     }
 
-    if (ghost->path.is_valid && !CL_ListIsEmpty(ghost->path.path)) // Moving the ghost along the path.
+    if (events->flags & (PM_EVT_VICTORY | PM_EVT_DEFEAT))
     {
-        PM_MazeCell next_cell;
-        CL_ListPopFront(ghost->path.path, &next_cell);
-        LCD_RMMove(ghost->id, maze_cell_to_coords_img(next_cell, &Image_PACMAN_RedGhost, ANC_CENTER), true);
-
-        // Need to restore the previous cell to its original state and update the current cell.
-        // Checking if at the actual ghost position there is a pill or a super pill.
-        if (sGame.pill_ids[ghost->cell.row][ghost->cell.col] > 0)
-            sCurrentMaze[ghost->cell.row][ghost->cell.col] = PM_PILL;
-        else
-        {
-            // Checking for a super pill.
-            bool super_pill = false;
-            for (u8 i = 0; i < PM_SUP_PILL_COUNT; i++)
-            {
-                if (sGame.super_pills[i].cell.row == ghost->cell.row &&
-                    sGame.super_pills[i].cell.col == ghost->cell.col)
-                {
-                    sCurrentMaze[ghost->cell.row][ghost->cell.col] = PM_SUPER_PILL;
-                    super_pill = true;
-                    break;
-                }
-            }
-
-            // If there is no super pill, the cell is empty.
-            if (!super_pill)
-                sCurrentMaze[ghost->cell.row][ghost->cell.col] = PM_NONE;
-        }
-
-        sCurrentMaze[ghost->cell.row][ghost->cell.col] = PM_NONE;
-        sCurrentMaze[next_cell.row][next_cell.col] = PM_GHSR;
-        ghost->cell = next_cell;
+        sView.new_record = events->flags & PM_EVT_NEW_RECORD;
+        sNextView = (events->flags & PM_EVT_VICTORY) ? game_victory : game_defeat;
     }
 }
 
-_PRIVATE _CBACK void ghost_path_invalidator(void)
+// Moves the sprites of PacMan and of the ghosts along their way, once per frame, whatever the ticks simulated.
+// Only the pixels that change are written, i.e. the strips of the sprites that move.
+_PRIVATE void draw_actors(void)
 {
-    // If PACMAN is still, we don't need to invalidate the path.
-    if (sGame.pacman.dir == PM_MOV_NONE)
-        return;
+    PM_Sprite *const pacman = &sView.sprites[SPRITE_PACMAN];
+    pacman->pos = sprite_coords(sGame->pacman.prev_cell, sGame->pacman.cell, sGame->pacman.step_acc, pacman->bitmap);
 
-    // If the game is not playing, we invalidate the path so that the ghost won't move
-    if (!sGame.playing_now)
+    const PM_Ghost *ghost;
+    for (u8 i = 0; i < PM_GHOST_COUNT; i++)
     {
-        sGame.ghost.path.is_valid = false;
-        return;
+        ghost = &sGame->ghosts[i];
+        sView.sprites[SPRITE_GHOST + i].pos =
+            sprite_coords(ghost->prev_cell, ghost->cell, ghost->step_acc, sView.sprites[SPRITE_GHOST + i].bitmap);
     }
-}
-
-_PRIVATE _CBACK void ghost_scared_counter(void)
-{
-    if (!sGame.playing_now || !sGame.ghost.is_scared)
-        return;
-
-    // If the ghost is scared, we need to decrement the counter.
-    if (sGame.ghost.scared_counter < PM_GHOST_SCARED_DURATION)
-        sGame.ghost.scared_counter++;
 
-    // If the counter reaches 0, the ghost is no longer scared.
-    if (sGame.ghost.scared_counter == PM_GHOST_SCARED_DURATION)
-    {
-        sGame.ghost.is_scared = false;
-        sGame.ghost.scared_counter = 0;
-
-        // Reinitializing the ghost to its original color.
-        LCD_RMRemove(sGame.ghost.id, false);
-        init_ghost(false);
-
-        // Disabling the scared counter job.
-        RIT_DisableJob(ghost_scared_counter);
-    }
+    sFrameStats.sprite_pixels += PM_SpritesDraw(sView.sprites, SPRITE_COUNT, maze_background);
 }
 
-// CALLBACKS
+// INPUT
 
-_PRIVATE _CBACK void render_loop(void)
+// Stores the direction for the next frame. The joystick calls back as long as it's held, so the tick
+// is only taken when the direction changes.
+_PRIVATE inline void ask_dir(PM_MovementDir dir)
 {
-    // If not playing or moving, nothing new to render.
-    if (!sGame.playing_now || sGame.pacman.dir == PM_MOV_NONE)
-        return;
-
-    // Checking PacMan sorroundings. If there is a wall or the maze's boundaries
-    // along the direction of movement, he can't move and just stops till new dir.
-    PM_MazeCell new, pacman = sGame.pacman.cell;
-    switch (sGame.pacman.dir)
+    if (dir != sAskedDir)
     {
-    case PM_MOV_UP:
-        // If the cell above (row - 1) is not a wall, continue.
-        if (pacman.row > 0 && sCurrentMaze[pacman.row - 1][pacman.col] != PM_WALL)
-        {
-            new.row = pacman.row - 1;
-            new.col = pacman.col;
-            break;
-        }
-        else
-        {
-            sGame.pacman.dir = PM_MOV_NONE;
-            return;
-        }
-    case PM_MOV_DOWN:
-        if (pacman.row < PM_MAZE_SCALED_HEIGHT - 1 && sCurrentMaze[pacman.row + 1][pacman.col] != PM_WALL)
-        {
-            new.row = pacman.row + 1;
-            new.col = pacman.col;
-            break;
-        }
-        else
-        {
-            sGame.pacman.dir = PM_MOV_NONE;
-            return;
-        }
-    case PM_MOV_LEFT:
-        // If the cell to the left (col - 1) is not a wall, continue.
-        if (pacman.col > 0 && sCurrentMaze[pacman.row][pacman.col - 1] != PM_WALL)
-        {
-            new.row = pacman.row;
-            // If it's a teleport, jump to the right one.
-            new.col =
-                (sCurrentMaze[pacman.row][pacman.col - 1] == PM_LTPL) ? (PM_MAZE_SCALED_WIDTH - 2) : pacman.col - 1;
-            break;
-        }
-        else
-        {
-            sGame.pacman.dir = PM_MOV_NONE;
-            return;
-        }
-    case PM_MOV_RIGHT:
-        if (pacman.col < PM_MAZE_SCALED_WIDTH - 1 && sCurrentMaze[pacman.row][pacman.col + 1] != PM_WALL)
-        {
-            new.row = pacman.row;
-            // If it's a teleport, jump to the left one.
-            new.col = (sCurrentMaze[pacman.row][pacman.col + 1] == PM_RTPL) ? 1 : pacman.col + 1;
-            break;
-        }
-        else
-        {
-            sGame.pacman.dir = PM_MOV_NONE;
-            return;
-        }
-    default:
-        return;
+        sAskedDir = dir;
+        sAskedTick = sTicks;
     }
 
-    // Checking for pills or super pills in the next cell he's going to visit.
-    u16 cur_score = sGame.stat_values.score;
-    const PM_MazeObj new_obj = sCurrentMaze[new.row][new.col];
-    if (new_obj == PM_PILL || new_obj == PM_SUPER_PILL)
-    {
-        cur_score += (new_obj == PM_PILL) ? PM_STD_PILL_POINTS : PM_SUP_PILL_POINTS;
-        if (cur_score > sGame.stat_values.record)
-        {
-            sGame.prev_record = sGame.stat_values.record;
-            sGame.stat_values.record = cur_score;
-        }
-
-        if (cur_score > 0 && cur_score % 1000 == 0 && IS_BETWEEN_EQ(sGame.stat_values.lives, 1, MAX_LIVES - 1))
-            sGame.stat_values.lives++;
-
-        // Incrementing the score variable
-        sGame.stat_values.score = cur_score;
-
-        if (++sGame.stat_values.pills_eaten == (PM_SUP_PILL_COUNT + PM_STD_PILL_COUNT))
-            game_victory();
-
-        if (new_obj == PM_PILL)
-        {
-            // Removing the pill from the screen, and setting its ID to -1 in the array.
-            LCD_RMRemove(sGame.pill_ids[new.row][new.col], false);
-            sGame.pill_ids[new.row][new.col] = -1;
-        }
-        // If we ate a super pill, we need to scare the ghost.
-        else if (new_obj == PM_SUPER_PILL)
-        {
-            // Removing it from the screen, and setting its ID to -1 in the array.
-            for (u8 i = 0; i < PM_SUP_PILL_COUNT; i++)
-            {
-                if (sGame.super_pills[i].cell.row == new.row && sGame.super_pills[i].cell.col == new.col)
-                {
-                    LCD_RMRemove(sGame.super_pills[i].id, false);
-                    sGame.super_pills[i].id = -1;
-                    break;
-                }
-            }
-
-            sGame.ghost.is_scared = true;
-            RIT_EnableJob(ghost_scared_counter);
-            LCD_RMRemove(sGame.ghost.id, false);
-            init_ghost(true);
-        }
-    }
-
-    // Finally, moving PacMan.
-    LCD_RMMove(sGame.pacman.id, maze_cell_to_coords(new, ANC_CENTER), false);
-    sCurrentMaze[pacman.row][pacman.col] = PM_NONE;
-    sCurrentMaze[new.row][new.col] = PM_PCMN;
-    sGame.pacman.cell = new;
+    sInputDir = dir;
 }
 
-_PRIVATE _CBACK void stats_updater(void)
+// Measures the latency of the turn PacMan took on the tick, if it's the one asked for with the joystick.
+_PRIVATE void record_turn(u32 tick)
 {
-    // Not updating anything if game is not playing or PacMan is still.
-    if (!sGame.playing_now || sGame.pacman.dir == PM_MOV_NONE)
+    if (sGame->pacman.dir != sAskedDir)
         return;
 
-    LCD_OBJECT_UPDATE_COMMANDS(sGame.stat_obj_ids.score_record_values, false, {
-        sprintf(sGame.stat_strings.record, "%d", sGame.stat_values.record);
-        sprintf(sGame.stat_strings.score, "%d", sGame.stat_values.score);
-    });
+    const u32 latency = tick - sAskedTick;
+    sAskedDir = PM_MOV_NONE;
 
-    // If lives incremented, need to make another icon visible.
-    LCD_RMSetVisibility(sGame.stat_obj_ids.lives[sGame.stat_values.lives - 1], true, false);
+    sInputStats.turns++;
+    sInputStats.total_ticks += latency;
+    if (latency > sInputStats.max_ticks)
+        sInputStats.max_ticks = latency;
+
+    // The first tick it can be taken on is the one after the event, with a latency of 1.
+    const u32 bucket = latency > 0 ? latency - 1 : 0;
+    sInputStats.histogram[bucket < PM_INPUT_LATENCY_BUCKETS ? bucket : PM_INPUT_LATENCY_BUCKETS - 1]++;
 }
 
-_PRIVATE _CBACK void game_over_counter(void)
-{
-    // The GameOverIn counter counts down every second, not need to
-    // update at the same frequency as the other stats. That's why I kept it separate.
+// clang-format off
+_PRIVATE _CBACK void move_up(void) { ask_dir(PM_MOV_UP); }
+_PRIVATE _CBACK void move_down(void) { ask_dir(PM_MOV_DOWN); }
+_PRIVATE _CBACK void move_left(void) { ask_dir(PM_MOV_LEFT); }
+_PRIVATE _CBACK void move_right(void) { ask_dir(PM_MOV_RIGHT); }
+// clang-format on
 
-    // Still need to count down if PacMan is moving, provided that
-    // we're actually in the playing state.
-    if (!sGame.playing_now)
+// The pause button only asks for the toggle, which takes place on the next tick. A press within
+// PM_BUTTON_HOLDOFF_TICKS of the last one taken is a bounce of it.
+_PRIVATE _CBACK void pause_requester(void)
+{
+    if (sTicks - sPauseTick < PM_BUTTON_HOLDOFF_TICKS)
         return;
 
-    if (sGame.stat_values.game_over_in == 0 &&
-        (sGame.stat_values.pills_eaten < (PM_STD_PILL_COUNT + PM_SUP_PILL_COUNT)))
-        game_defeat();
-    else
-    {
-        // Simply update the GameOverIn counter string to the new (decremented) value.
-        sGame.stat_values.game_over_in--;
-
-        // clang-format off
-        LCD_OBJECT_UPDATE_COMMANDS(sGame.stat_obj_ids.game_over_in_value, false, {
-            sprintf(sGame.stat_strings.game_over_in, "%d", sGame.stat_values.game_over_in);
-        });
-        // clang-format on
-
-        // Checking if there's a super pill to spawn at the given time.
-        PM_SuperPill *pill;
-        for (u8 i = 0; i < PM_SUP_PILL_COUNT; i++)
-        {
-            pill = &(sGame.super_pills[i]);
-            if (pill->spawn_sec == sGame.stat_values.game_over_in)
-            {
-                LCD_RMSetVisibility(pill->id, true, false);
-                sCurrentMaze[pill->cell.row][pill->cell.col] = PM_SUPER_PILL;
-            }
-        }
-
-        // Every 20 seconds, we increase the speed of the ghosts by a little bit.
-        if (IS_BETWEEN_EQ(sGame.stat_values.game_over_in, 1, 59) && sGame.stat_values.game_over_in % 20 == 0)
-        {
-            const u8 current_factor = RIT_GetJobMultiplierFactor(red_ghost_ai);
-            RIT_SetJobMultiplierFactor(red_ghost_ai, current_factor - 1);
-        }
-    }
+    sPauseTick = sTicks;
+    sPauseRequested = true;
 }
 
-_PRIVATE _CBACK void pause_resume_game(void)
-{
-    // Toggling between playing or paused views. The pause view
-    // is located at the same place as the stats, so we don't need to delete/draw
-    // the maze (it is always visible, just not controllable during pause).
-    sGame.playing_now = !sGame.playing_now;
-    sGame.pacman.dir = PM_MOV_NONE;
-
-    if (sGame.playing_now)
-    {
-        LCD_RMSetVisibility(sPauseID, false, false);
-        JOYSTICK_EnableAction(JOY_ACTION_ALL);
-    }
-
-    LCD_RMSetVisibility(sGame.stat_obj_ids.titles, sGame.playing_now, false);
-    LCD_RMSetVisibility(sGame.stat_obj_ids.score_record_values, sGame.playing_now, false);
-    LCD_RMSetVisibility(sGame.stat_obj_ids.game_over_in_value, sGame.playing_now, false);
-
-    // Handling lives
-    for (u8 i = 0; i < sGame.stat_values.lives; i++)
-        LCD_RMSetVisibility(sGame.stat_obj_ids.lives[i], sGame.playing_now, false);
-
-    // If paused, we set the pause view visible after we've done hiding the playing views,
-    // otherwise we would have overlapping.
-    if (!sGame.playing_now)
-    {
-        LCD_RMSetVisibility(sPauseID, true, false);
-        JOYSTICK_DisableAction(JOY_ACTION_ALL);
-    }
-}
-
-// MOVEMENT CALLBACKS
-
-// clang-format off
-_PRIVATE _CBACK void move_up(void) { sGame.pacman.dir = PM_MOV_UP; }
-_PRIVATE _CBACK void move_down(void) { sGame.pacman.dir = PM_MOV_DOWN; }
-_PRIVATE _CBACK void move_left(void) { sGame.pacman.dir = PM_MOV_LEFT; }
-_PRIVATE _CBACK void move_right(void) { sGame.pacman.dir = PM_MOV_RIGHT; }
-// clang-format on
-
 // CALLBACK CONTROL
 
 _PRIVATE void bind_cbacks(void)
 {
-    RIT_EnableJob(render_loop);
-    RIT_EnableJob(game_over_counter);
-    RIT_EnableJob(stats_updater);
-
-    RIT_EnableJob(red_ghost_ai);
-    RIT_EnableJob(ghost_path_invalidator);
-
     JOYSTICK_EnableAction(JOY_ACTION_ALL);
     BUTTON_EnableSource(BTN_SRC_EINT0, 1);
 }
 
 _PRIVATE void unbind_cbacks(void)
 {
-    RIT_DisableJob(render_loop);
-    RIT_DisableJob(game_over_counter);
-    RIT_DisableJob(stats_updater);
-
-    RIT_DisableJob(red_ghost_ai);
-    RIT_DisableJob(ghost_path_invalidator);
-
     JOYSTICK_DisableAction(JOY_ACTION_ALL);
     BUTTON_DisableSource(BTN_SRC_EINT0);
 }
@@ -845,55 +475,41 @@ _PRIVATE void unbind_cbacks(void)
  */
 void do_play(void)
 {
-    sGame.stat_values = (PM_GameStatValues){
-        .pills_eaten = 0,
-        .game_over_in = 60,
-        .lives = 1,
-        .record = 0,
-        .score = 0,
-    };
+    // The seed of the super pills comes from the hardware entropy source.
+    PRNG_Set(PRNG_USE_AUTO_SEED);
+    const u32 seed = PRNG_Next();
+    PRNG_Release();
+
+    // Recording the game over the oldest one.
+    sReplayHead = (sReplayHead + 1) % PM_REPLAY_HISTORY;
+    if (sReplayCount < PM_REPLAY_HISTORY)
+        sReplayCount++;
 
-    // Copying the maze into a new array, so we can modify it without affecting the original.
-    memcpy((void *)sCurrentMaze, PACMAN_BaseMaze, sizeof(PACMAN_BaseMaze));
+    PM_ReplayRecordNewGame(&sReplays[sReplayHead], sSpeed, seed);
 
     LCD_RMClear();
     init_info();
     init_pause();
-    init_super_pills();
+    init_sprites();
     draw_maze();
-    init_ghost(false);
+    draw_actors();
+    sView.stats_elapsed = 0;
 
-    // Determining the initial PacMan position
-    for (u16 row = 0; row < PM_MAZE_SCALED_HEIGHT; row++)
-    {
-        for (u16 col = 0; col < PM_MAZE_SCALED_WIDTH; col++)
-        {
-            // Always starting from the original position.
-            if (PACMAN_BaseMaze[row][col] == PM_PCMN)
-            {
-                sGame.pacman.cell = (PM_MazeCell){row, col};
-                break;
-            }
-        }
-    }
-
-    // Enabling controls & RIT
+    // Enabling controls. The ticks elapsed and the input given till now are not part of the game.
     bind_cbacks();
-
-    // Playing.
-    sGame.playing_now = true;
+    sTicksDone = sTicks;
+    sInputDir = PM_MOV_NONE;
+    sAskedDir = PM_MOV_NONE;
+    sPauseRequested = false;
 }
 
 _PRIVATE void game_victory(void)
 {
     LCD_SetBackgroundColor(LCD_COL_BLACK, false);
 
-    // Disabling controls & stopping the game
+    // Disabling controls, the game is already stopped
     unbind_cbacks();
 
-    sGame.playing_now = false;
-    sGame.pacman.dir = PM_MOV_NONE;
-
     // Showing a victory view.
     const LCD_Coordinate image_pos = {
         .x = LCD_GetWidth() / 2 - (Image_PACMAN_Victory.width / 2),
@@ -901,7 +517,7 @@ _PRIVATE void game_victory(void)
     };
 
     char score_str[10];
-    sprintf(score_str, "SCORE: %d", sGame.stat_values.score);
+    sprintf(score_str, "SCORE: %d", sGame->stat_values.score);
     const LCD_Coordinate score_pos = {LCD_GetWidth() / 2 - 50, LCD_GetHeight() / 2 + 50};
 
     // clang-format off
@@ -915,12 +531,11 @@ _PRIVATE void game_victory(void)
     // clang-format on
 
     // If a new record has been reached, showing the new record message.
-    const bool new_record = sGame.stat_values.record > sGame.prev_record;
+    const bool new_record = sView.new_record;
     if (new_record)
     {
         char new_record_str[30];
-        sGame.prev_record = sGame.stat_values.record;
-        sprintf(new_record_str, "NEW RECORD: %d", sGame.prev_record);
+        sprintf(new_record_str, "NEW RECORD: %d", sGame->prev_record);
 
         // clang-format off
         LCD_RENDER_TMP({
@@ -956,15 +571,12 @@ _PRIVATE void game_defeat(void)
 {
     LCD_SetBackgroundColor(LCD_COL_BLACK, false);
 
-    // Disabling controls & stopping the game
+    // Disabling controls, the game is already stopped
     unbind_cbacks();
 
-    sGame.playing_now = false;
-    sGame.pacman.dir = PM_MOV_NONE;
-
     // Showing a defeat view.
     char score_str[10];
-    sprintf(score_str, "SCORE: %d", sGame.stat_values.score);
+    sprintf(score_str, "SCORE: %d", sGame->stat_values.score);
 
     // Showing a victory view.
     const LCD_Coordinate image_pos = {
@@ -1009,6 +621,10 @@ _PRIVATE void game_defeat(void)
     do_play(); // The user clicked!
 }
 
+// GAME LOOP
+
+_PRIVATE _CBACK void tick_counter(void) { sTicks++; }
+
 // PUBLIC FUNCTIONS
 
 void PACMAN_Init(void)
@@ -1025,30 +641,40 @@ void PACMAN_Init(void)
     // Initializing the TouchPanel, and starting its calibration phase.
     TP_Init(false);
 
-    // Initializing the RIT to 50ms, with a very high priority, since
-    // it will be heavily used by the game.
-    RIT_Init(sAllocator, 50, 1);
+    // Initializing the RIT to the tick of the game, with a very high priority,
+    // since it will be heavily used by the game.
+    RIT_Init(sAllocator, PM_TICK_MS, 1);
     RIT_Enable();
+    RIT_AddJob(tick_counter, 1);
+    RIT_EnableJob(tick_counter);
+
+    // Enabling the cycle counter of the DWT, to time the frames.
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
 
     JOYSTICK_Init();
     BUTTON_Init(BTN_DEBOUNCE_WITH_RIT);
 
     LCD_FMAddFont(Font_Upheaval14, &sFont14);
     LCD_FMAddFont(Font_Upheaval20, &sFont20);
+    sDigitAdvance = PM_HudDigitAdvance(&Font_Upheaval14, 2);
 
-    sGame.maze_pos = (LCD_Coordinate){
+    PM_SpriteLoadCircle(&sPacManBitmap, PM_PACMAN_RADIUS, PM_PACMAN_COLOR);
+    PM_SpriteLoadImage(&sGhostFrames[GHOST_FRAME_CHASING], &Image_PACMAN_RedGhost);
+    PM_SpriteLoadImage(&sGhostFrames[GHOST_FRAME_SCARED], &Image_PACMAN_YellowGhost);
+
+    sGame = PM_CoreGetGame();
+    sView.maze_pos = (LCD_Coordinate){
         .x = (LCD_GetWidth() - PM_MAZE_PIXEL_WIDTH) / 2,
         .y = LCD_GetHeight() - PM_MAZE_PIXEL_HEIGHT - 35,
     };
-
-    // The previous record is maintained till the board is reset.
-    sGame.prev_record = 0;
 }
 
 void PACMAN_Play(PM_Speed speed)
 {
     // Setting the game speed.
-    sGame.pacman.speed = speed;
+    sSpeed = speed;
 
     // Displaying the splash screen and waiting for user input.
     const LCD_Coordinate logo_pos = {
@@ -1071,16 +697,6 @@ void PACMAN_Play(PM_Speed speed)
     TP_WaitForButtonPress(button_tp);
     LCD_SetBackgroundColor(LCD_COL_BLACK, false);
 
-    // Adding jobs to RIT.
-    RIT_AddJob(render_loop, speed);    // 50ms * speed(0|1|2) = 0|50|100ms update
-    RIT_AddJob(game_over_counter, 20); // 50ms * 20 = 1sec update
-    RIT_AddJob(stats_updater, 10);     // 50ms * 10 = 0.5sec update
-
-    // Ghosts jobs
-    RIT_AddJob(red_ghost_ai, speed + 2);   // Changes every 20secs // 50ms * (2|3|4) = 100|150|200ms update
-    RIT_AddJob(ghost_path_invalidator, 5); // 50ms * 5 = 0.25sec update
-    RIT_AddJob(ghost_scared_counter, 20);  // 50ms * 20 = 1sec update
-
     // Setting up joystick controls
     JOYSTICK_SetFunction(JOY_ACTION_UP, move_up);
     JOYSTICK_SetFunction(JOY_ACTION_DOWN, move_down);
@@ -1088,8 +704,92 @@ void PACMAN_Play(PM_Speed speed)
     JOYSTICK_SetFunction(JOY_ACTION_RIGHT, move_right);
 
     // Setting up pause button
-    BUTTON_SetFunction(BTN_SRC_EINT0, pause_resume_game);
+    BUTTON_SetFunction(BTN_SRC_EINT0, pause_requester);
 
     // If here, user clicked on START.
     do_play();
+}
+
+bool PACMAN_HasPendingTicks(void)
+{
+    return sTicks != sTicksDone;
+}
+
+void PACMAN_Update(void)
+{
+    if (!PACMAN_HasPendingTicks())
+        return;
+
+    const u32 start = DWT->CYCCNT;
+
+    // If the last frame overran, the ticks missed are simulated now, up to PM_MAX_TICKS_PER_FRAME.
+    u32 ticks = sTicks - sTicksDone;
+    sTicksDone += ticks;
+    if (ticks > PM_MAX_TICKS_PER_FRAME)
+    {
+        sFrameStats.skipped_ticks += ticks - PM_MAX_TICKS_PER_FRAME;
+        ticks = PM_MAX_TICKS_PER_FRAME;
+    }
+
+    // The input is given to the first tick only. The ticks simulated are the last ones elapsed. The
+    // interrupts are masked between the read and the clear, otherwise an input coming in between is lost.
+    __disable_irq();
+    PM_Input input = {.dir = sInputDir, .toggle_pause = sPauseRequested};
+    sInputDir = PM_MOV_NONE;
+    sPauseRequested = false;
+    __enable_irq();
+
+    PM_Events events;
+    for (u32 tick = sTicksDone - ticks + 1; ticks && !sNextView; ticks--, tick++)
+    {
+        events = PM_ReplayRecordStep(&sReplays[sReplayHead], input);
+        input = (PM_Input){PM_MOV_NONE, false};
+        apply_events(&events);
+        sFrameStats.ticks++;
+
+        if (events.flags & PM_EVT_TURN_TAKEN)
+            record_turn(tick);
+
+        // The stats are redrawn every 0.5sec at most, since drawing text is slow.
+        if (++sView.stats_elapsed >= PM_TICKS_PER_SEC / 2)
+        {
+            sView.stats_elapsed = 0;
+            update_stats();
+        }
+    }
+
+    // The game is over: the view waits for the user to start a new game, hence the frame is not timed.
+    if (sNextView)
+    {
+        void (*const view)(void) = sNextView;
+        sNextView = NULL;
+        view();
+        return;
+    }
+
+    draw_actors();
+
+    const u32 cycles = DWT->CYCCNT - start;
+    sFrameStats.frames++;
+    sFrameStats.last_cycles = cycles;
+    if (cycles > sFrameStats.max_cycles)
+        sFrameStats.max_cycles = cycles;
+}
+
+PM_FrameStats PACMAN_GetFrameStats(void)
+{
+    return sFrameStats;
+}
+
+PM_InputStats PACMAN_GetInputStats(void)
+{
+    return sInputStats;
+}
+
+const PM_Replay *PACMAN_GetReplay(u8 games_ago)
+{
+    if (games_ago >= sReplayCount)
+        return NULL;
+
+    return &sReplays[(sReplayHead + PM_REPLAY_HISTORY - games_ago) % PM_REPLAY_HISTORY];
 }
\ No newline at end of file
@@ -2,9 +2,28 @@
 #define __PACMAN_H
 
 #include "pacman_types.h"
+#include "pacman_replay.h"
 
 void PACMAN_Init(void);
 
 void PACMAN_Play(PM_Speed speed);
 
+/// @brief Whether the RIT ticked since the last update, i.e. whether there's a frame to run.
+bool PACMAN_HasPendingTicks(void);
+
+/// @brief Runs a frame of the game: simulates the ticks elapsed since the last call, updates
+///        the screen and switches view if the game is over. Meant to be called in thread mode.
+void PACMAN_Update(void);
+
+PM_FrameStats PACMAN_GetFrameStats(void);
+
+/// @brief Returns the latency of the turns taken, since the board was started.
+PM_InputStats PACMAN_GetInputStats(void);
+
+/// @brief Returns the recording of a game, to be replayed bit-exactly with PM_ReplayPlayNewGame,
+///        on the board or on a host build of the core.
+/// @param games_ago 0 for the game being played (or the last one), up to PM_REPLAY_HISTORY - 1.
+/// @return NULL if there's no such game.
+const PM_Replay *PACMAN_GetReplay(u8 games_ago);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,654 @@
+#include "pacman_core.h"
+#include "pacman_path.h"
+#include "pacman_timer.h"
+
+#include <string.h>
+
+// Images
+#include "Assets/Images/pacman-maze.h"
+
+// PRIVATE TYPES
+
+// clang-format off
+enum CoreJobID { JOB_PACMAN, JOB_TIMERS, JOB_GHOST_AI, JOB_COUNT };
+
+// Timed events of the game, posted on the timer wheel. Those due on the same tick fire in this order.
+enum CoreTimerID
+{
+    TIMER_SECOND,         // A second of the countdown elapses
+    TIMER_SUPER_PILL,     // Super pill i spawns, with ID TIMER_SUPER_PILL + i
+    TIMER_GHOST_SPEED_UP = TIMER_SUPER_PILL + PM_SUP_PILL_COUNT,
+    TIMER_GHOST_CALM,     // The ghost is no longer scared
+    TIMER_COUNT
+};
+// clang-format on
+
+_Static_assert(TIMER_COUNT <= PM_TIMER_MAX_COUNT, "The timers of the core must fit in the wheel");
+
+// Periodic job of the game, run every `period` ticks.
+typedef struct
+{
+    void (*run)(void);
+    u8 period, elapsed;
+} CoreJob;
+
+// Speeds of a difficulty level. The ghost speeds up by `ghost_ramp` every second, till 20 seconds are left.
+typedef struct
+{
+    u16 pacman, ghost, ghost_ramp;
+} LevelSpeeds;
+
+// CONSTANTS
+
+// clang-format off
+_PRIVATE const LevelSpeeds sLevels[] = {
+    [PM_SPEED_FAST] = {PM_CELLS_PER_SEC(25), PM_CELLS_PER_SEC(10), PM_CELLS_PER_SEC(10.0 / 40)},  // Ghost: 10 to 20 cells/s
+    [PM_SPEED_NORMAL] = {PM_CELLS_PER_SEC(20), PM_CELLS_PER_SEC(20.0 / 3), PM_CELLS_PER_SEC(1.0 / 3)}, // Ghost: 6.7 to 20 cells/s
+    [PM_SPEED_SLOW] = {PM_CELLS_PER_SEC(10), PM_CELLS_PER_SEC(5), PM_CELLS_PER_SEC(5.0 / 40)},     // Ghost: 5 to 10 cells/s
+};
+// clang-format on
+
+// STATE VARIABLES
+
+_PRIVATE _PM_GAME_STATE PM_Game sGame;
+_PRIVATE _PM_GAME_STATE PM_MazeTiles sTiles;                  // Static layer of the base maze
+_PRIVATE _PM_GAME_STATE PM_MazeRows sBasePills, sBaseSuperPills; // Collectible layer a game starts with
+_PRIVATE _PM_GAME_STATE bool sIsMazeLoaded;
+_PRIVATE _PM_GAME_STATE CoreJob sJobs[JOB_COUNT];
+_PRIVATE _PM_GAME_STATE PM_TimerWheel sTimers; // Keyed on the ticks played, i.e. not paused
+_PRIVATE _PM_GAME_STATE PM_Events sEvents; // Raised by the tick being run
+_PRIVATE _PM_GAME_STATE u32 sRandomState;
+_PRIVATE _PM_GAME_STATE PM_Speed sLevel;
+
+// Ghosts standing on each cell, as a mask in which bit i stands for ghost i. It's kept up to date on
+// each move, so that PacMan finds the ghosts he runs into by looking at his cell only.
+_PRIVATE _PM_GAME_STATE u8 sGhostGrid[PM_MAZE_SCALED_HEIGHT][PM_MAZE_SCALED_WIDTH];
+
+_Static_assert(PM_GHOST_COUNT <= 8, "Each ghost must have its own bit in the cells of the ghost grid");
+
+// UTILS
+
+// Xorshift32: the super pills must come out the same from a seed, on the board and on a host alike.
+_PRIVATE u32 random_next(void)
+{
+    sRandomState ^= sRandomState << 13;
+    sRandomState ^= sRandomState >> 17;
+    sRandomState ^= sRandomState << 5;
+    return sRandomState;
+}
+
+// Returns a pseudo-random number in the given range, inclusive.
+_PRIVATE u32 random_range(u32 min, u32 max)
+{
+    return min + random_next() % (max - min + 1);
+}
+
+// Adds the speed of an entity to its accumulator, and tells whether it gathered a step.
+_PRIVATE inline bool take_step(u16 speed, u16 *const acc)
+{
+    *acc += speed;
+    if (*acc < PM_SPEED_STEP)
+        return false;
+
+    *acc -= PM_SPEED_STEP;
+    return true;
+}
+
+// Stops the game, raising the event of its outcome.
+_PRIVATE void end_game(PM_EventFlag outcome)
+{
+    sGame.playing_now = false;
+    sGame.is_over = true;
+    sGame.pacman.dir = PM_MOV_NONE;
+    sGame.pacman.next_dir = PM_MOV_NONE;
+    sEvents.flags |= outcome;
+
+    if (outcome == PM_EVT_VICTORY && sGame.stat_values.record > sGame.prev_record)
+    {
+        sGame.prev_record = sGame.stat_values.record;
+        sEvents.flags |= PM_EVT_NEW_RECORD;
+    }
+}
+
+// Adds the points to the score, bringing the record up to date. An extra life is given every 1000 points.
+_PRIVATE void add_score(u16 points)
+{
+    const u16 cur_score = sGame.stat_values.score + points;
+    if (cur_score > sGame.stat_values.record)
+    {
+        sGame.prev_record = sGame.stat_values.record;
+        sGame.stat_values.record = cur_score;
+    }
+
+    if (cur_score > 0 && cur_score % 1000 == 0 && IS_BETWEEN_EQ(sGame.stat_values.lives, 1, MAX_LIVES - 1))
+        sGame.stat_values.lives++;
+
+    sGame.stat_values.score = cur_score;
+    sEvents.flags |= PM_EVT_STATS_CHANGED;
+}
+
+// MAZE BITBOARD
+
+_PRIVATE inline bool maze_has(const PM_MazeRows plane, PM_MazeCell cell)
+{
+    return plane[cell.row] & PM_MAZE_BIT(cell.col);
+}
+
+_PRIVATE inline void maze_set(PM_MazeRows plane, PM_MazeCell cell, bool value)
+{
+    if (value)
+        plane[cell.row] |= PM_MAZE_BIT(cell.col);
+    else
+        plane[cell.row] &= ~PM_MAZE_BIT(cell.col);
+}
+
+// Pills that still have to be eaten, including the super pills that haven't spawned yet.
+_PRIVATE u16 maze_pills_remaining(void)
+{
+    u16 count = sGame.super_pills_to_spawn;
+    for (u16 row = 0; row < PM_MAZE_SCALED_HEIGHT; row++)
+        count += __builtin_popcount(sGame.maze.pills[row] | sGame.maze.super_pills[row]);
+
+    return count;
+}
+
+// Converts a maze from the PM_MazeObj representation used in the assets to the layers of the bitboard one.
+_PRIVATE void load_maze(const PM_MazeObj maze[PM_MAZE_SCALED_HEIGHT][PM_MAZE_SCALED_WIDTH])
+{
+    memset(&sTiles, 0, sizeof(sTiles));
+    memset(sBasePills, 0, sizeof(sBasePills));
+    memset(sBaseSuperPills, 0, sizeof(sBaseSuperPills));
+    for (u16 row = 0; row < PM_MAZE_SCALED_HEIGHT; row++)
+    {
+        for (u16 col = 0; col < PM_MAZE_SCALED_WIDTH; col++)
+        {
+            switch (maze[row][col])
+            {
+            case PM_WALL:
+                sTiles.walls[row] |= PM_MAZE_BIT(col);
+                break;
+            case PM_PILL:
+                sBasePills[row] |= PM_MAZE_BIT(col);
+                break;
+            case PM_SUPER_PILL:
+                sBaseSuperPills[row] |= PM_MAZE_BIT(col);
+                break;
+            case PM_LTPL:
+            case PM_RTPL:
+                sTiles.portals[row] |= PM_MAZE_BIT(col);
+                break;
+            case PM_PCMN:
+                sTiles.pacman_spawn = (PM_MazeCell){row, col};
+                break;
+            case PM_GHSR:
+                sTiles.ghost_spawn = (PM_MazeCell){row, col};
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    sIsMazeLoaded = true;
+}
+
+// Lays the pills of the base maze on its tiles, which are loaded on the first game only.
+_PRIVATE void reset_maze(void)
+{
+    if (!sIsMazeLoaded)
+        load_maze(PACMAN_BaseMaze);
+
+    sGame.maze.tiles = &sTiles;
+    memcpy(sGame.maze.pills, sBasePills, sizeof(sBasePills));
+    memcpy(sGame.maze.super_pills, sBaseSuperPills, sizeof(sBaseSuperPills));
+    PM_PathLoadMaze(&sTiles);
+}
+
+// POWER PILLS
+
+_PRIVATE inline bool super_pill_spawn_second_already_taken(u32 sec, u16 super_pills_arr_length)
+{
+    for (u8 i = 0; i < super_pills_arr_length; i++)
+        if (sGame.super_pills[i].spawn_sec == sec)
+            return true;
+
+    return false;
+}
+
+_PRIVATE void init_super_pills(u32 seed)
+{
+    // 6 Super pills need to be generated at random positions in the maze
+    // (i.e. we have to randomize the row & col values of the maze cells),
+    // and at random times (i.e. we have to randomize the time intervals
+    // between the generation of each power pill), till the end of the 60s.
+    sRandomState = seed ? seed : 0x9E3779B9; // 0 is the only seed xorshift can't leave
+
+    u16 i = 0, row, col, spawn_sec = 0;
+    while (i < PM_SUP_PILL_COUNT)
+    {
+        // Generate random position in maze
+        row = random_range(1, PM_MAZE_SCALED_HEIGHT - 1);
+        col = random_range(1, PM_MAZE_SCALED_WIDTH - 1);
+
+        // Checking if the cell is not a wall, another power pill, PacMan,
+        // a teleport, or a ghost. If it is, we need to generate another one.
+        if (!maze_has(sGame.maze.pills, (PM_MazeCell){row, col}))
+            continue;
+
+        sGame.super_pills[i].cell = (PM_MazeCell){row, col};
+
+        // Generate random times for the power pills to spawn
+        do
+        {
+            spawn_sec = random_range(5, 59);
+        } while (super_pill_spawn_second_already_taken(spawn_sec, i));
+
+        sGame.super_pills[i].spawn_sec = spawn_sec;
+        i++;
+    }
+
+    sGame.super_pills_to_spawn = PM_SUP_PILL_COUNT;
+}
+
+// PACMAN
+
+// Whether a wall, or the maze's boundaries, keep PacMan from moving along the direction.
+_PRIVATE bool pacman_is_blocked(PM_MovementDir dir)
+{
+    const PM_MazeCell cell = sGame.pacman.cell;
+    switch (dir)
+    {
+    case PM_MOV_UP:
+        return cell.row == 0 || (sTiles.walls[cell.row - 1] & PM_MAZE_BIT(cell.col));
+    case PM_MOV_DOWN:
+        return cell.row == PM_MAZE_SCALED_HEIGHT - 1 || (sTiles.walls[cell.row + 1] & PM_MAZE_BIT(cell.col));
+    case PM_MOV_LEFT:
+        return cell.col == 0 || (sTiles.walls[cell.row] & PM_MAZE_BIT(cell.col - 1));
+    case PM_MOV_RIGHT:
+        return cell.col == PM_MAZE_SCALED_WIDTH - 1 || (sTiles.walls[cell.row] & PM_MAZE_BIT(cell.col + 1));
+    default:
+        return true;
+    }
+}
+
+// COLLISIONS
+
+_PRIVATE inline void ghost_grid_move(u8 index, PM_MazeCell from, PM_MazeCell to)
+{
+    sGhostGrid[from.row][from.col] &= ~(1U << index);
+    sGhostGrid[to.row][to.col] |= 1U << index;
+}
+
+// Puts the ghost back on its spawn cell, with no path.
+_PRIVATE void respawn_ghost(u8 index)
+{
+    PM_Ghost *const ghost = &sGame.ghosts[index];
+    const PM_MazeCell spawn = sTiles.ghost_spawn;
+    ghost_grid_move(index, ghost->cell, spawn);
+    ghost->cell = spawn;
+    ghost->prev_cell = spawn;
+    ghost->step_acc = 0;
+    ghost->path.is_valid = false;
+    sEvents.flags |= PM_EVT_GHOST_MOVED;
+}
+
+// Takes a life. If any is left, PacMan and the ghosts start over from their spawn cells, and the pills
+// eaten so far stay eaten.
+_PRIVATE void lose_life(void)
+{
+    sGame.stat_values.lives--;
+    sEvents.flags |= PM_EVT_LIFE_LOST | PM_EVT_STATS_CHANGED;
+    if (sGame.stat_values.lives == 0)
+    {
+        end_game(PM_EVT_DEFEAT);
+        return;
+    }
+
+    const PM_MazeCell spawn = sTiles.pacman_spawn;
+    sGame.pacman.cell = spawn;
+    sGame.pacman.prev_cell = spawn;
+    sGame.pacman.dir = PM_MOV_NONE;
+    sGame.pacman.next_dir = PM_MOV_NONE;
+    sGame.pacman.step_acc = 0;
+    sEvents.flags |= PM_EVT_PACMAN_MOVED;
+    PM_PathUpdatePacMan(spawn);
+
+    for (u8 i = 0; i < PM_GHOST_COUNT; i++)
+        respawn_ghost(i);
+}
+
+// Resolves the collisions on PacMan's cell, one ghost at a time: a scared one is eaten and respawns
+// calmed down, any other one takes a life. Only the ghosts on the cell are looked at, not all of them.
+// The cell is looked at again after each respawn, since PacMan or a ghost may be put back on the other.
+_PRIVATE void resolve_collisions(void)
+{
+    u8 ghosts, i;
+    while (!sGame.is_over && (ghosts = sGhostGrid[sGame.pacman.cell.row][sGame.pacman.cell.col]))
+    {
+        i = __builtin_ctz(ghosts);
+        if (!sGame.ghosts[i].is_scared)
+        {
+            lose_life();
+            continue;
+        }
+
+        add_score(PM_GHOST_POINTS);
+        sGame.ghosts[i].is_scared = false;
+        respawn_ghost(i);
+        sEvents.flags |= PM_EVT_GHOST_EATEN;
+    }
+}
+
+// GHOST JOBS
+
+_PRIVATE void move_ghost(u8 index)
+{
+    PM_Ghost *const ghost = &sGame.ghosts[index];
+    // The ghost moves at its own pace. If the game is not playing, we don't need to move it.
+    if (!take_step(ghost->speed, &ghost->step_acc))
+        return;
+
+    // The front end draws the ghost on its way from the cell it leaves, till the next step.
+    ghost->prev_cell = ghost->cell;
+    if (!sGame.playing_now)
+        return;
+
+    PM_MazeCell next_cell;
+    if (!PM_PathGhostNextCell(ghost, &next_cell))
+        return;
+
+    // The ghost is not stored in the maze bitboard, so the pills it walks over are left untouched.
+    ghost_grid_move(index, ghost->cell, next_cell);
+    ghost->cell = next_cell;
+    sEvents.flags |= PM_EVT_GHOST_MOVED;
+
+    if (next_cell.row == sGame.pacman.cell.row && next_cell.col == sGame.pacman.cell.col)
+        resolve_collisions();
+}
+
+_PRIVATE void ghosts_ai(void)
+{
+    for (u8 i = 0; i < PM_GHOST_COUNT; i++)
+        move_ghost(i);
+}
+
+// JOBS
+
+_PRIVATE void pacman_mover(void)
+{
+    // PacMan moves at his own pace. If not playing or moving, nothing new to simulate.
+    if (!take_step(sGame.pacman.speed, &sGame.pacman.step_acc))
+        return;
+
+    // The front end draws him on his way from the cell he leaves, till the next step.
+    sGame.pacman.prev_cell = sGame.pacman.cell;
+    if (!sGame.playing_now)
+        return;
+
+    // Taking the turn asked for, as soon as there's no wall along it.
+    if (sGame.pacman.next_dir != PM_MOV_NONE && !pacman_is_blocked(sGame.pacman.next_dir))
+    {
+        sGame.pacman.dir = sGame.pacman.next_dir;
+        sGame.pacman.next_dir = PM_MOV_NONE;
+        sEvents.flags |= PM_EVT_TURN_TAKEN;
+    }
+
+    if (sGame.pacman.dir == PM_MOV_NONE)
+        return;
+
+    // Checking PacMan sorroundings. If there is a wall or the maze's boundaries
+    // along the direction of movement, he can't move and just stops till new dir.
+    // The turn asked for, if any, stays queued.
+    if (pacman_is_blocked(sGame.pacman.dir))
+    {
+        sGame.pacman.dir = PM_MOV_NONE;
+        return;
+    }
+
+    PM_MazeCell new = sGame.pacman.cell;
+    switch (sGame.pacman.dir)
+    {
+    case PM_MOV_UP:
+        new.row--;
+        break;
+    case PM_MOV_DOWN:
+        new.row++;
+        break;
+    case PM_MOV_LEFT:
+        // If it's a teleport, jump to the right one.
+        new.col = (sTiles.portals[new.row] & PM_MAZE_BIT(new.col - 1)) ? (PM_MAZE_SCALED_WIDTH - 2) : new.col - 1;
+        break;
+    case PM_MOV_RIGHT:
+        // If it's a teleport, jump to the left one.
+        new.col = (sTiles.portals[new.row] & PM_MAZE_BIT(new.col + 1)) ? 1 : new.col + 1;
+        break;
+    default:
+        return;
+    }
+
+    // Checking for pills or super pills in the next cell he's going to visit.
+    const PM_MazeObj new_obj = maze_has(sGame.maze.pills, new)         ? PM_PILL
+                               : maze_has(sGame.maze.super_pills, new) ? PM_SUPER_PILL
+                                                                       : PM_NONE;
+    if (new_obj == PM_PILL || new_obj == PM_SUPER_PILL)
+    {
+        add_score((new_obj == PM_PILL) ? PM_STD_PILL_POINTS : PM_SUP_PILL_POINTS);
+        sGame.stat_values.pills_eaten++;
+        sEvents.pill_cell = new;
+
+        if (new_obj == PM_PILL)
+        {
+            maze_set(sGame.maze.pills, new, false);
+            sEvents.flags |= PM_EVT_PILL_EATEN;
+        }
+        // If we ate a super pill, we need to scare the ghost.
+        else if (new_obj == PM_SUPER_PILL)
+        {
+            maze_set(sGame.maze.super_pills, new, false);
+            sEvents.flags |= PM_EVT_SUPER_PILL_EATEN | PM_EVT_GHOST_SCARED;
+
+            // Another super pill eaten while the ghosts are scared keeps them scared for longer.
+            for (u8 i = 0; i < PM_GHOST_COUNT; i++)
+                sGame.ghosts[i].is_scared = true;
+
+            PM_TimerPost(&sTimers, TIMER_GHOST_CALM, PM_GHOST_SCARED_DURATION * PM_TICKS_PER_SEC);
+        }
+
+        // The game is won, PacMan stays where he is.
+        if (!maze_pills_remaining())
+        {
+            end_game(PM_EVT_VICTORY);
+            return;
+        }
+    }
+
+    // Finally, moving PacMan.
+    sGame.pacman.cell = new;
+    sEvents.flags |= PM_EVT_PACMAN_MOVED;
+    PM_PathUpdatePacMan(new);
+
+    // Ghosts moving after him on this tick are caught by move_ghost. A ghost he swaps cells with is
+    // still on its cell at this point, since PacMan moves first, hence it's caught here.
+    resolve_collisions();
+}
+
+// TIMERS
+
+_PRIVATE void second_elapsed(void)
+{
+    if (sGame.stat_values.game_over_in == 0 && maze_pills_remaining())
+    {
+        end_game(PM_EVT_DEFEAT);
+        return;
+    }
+
+    sGame.stat_values.game_over_in--;
+    sEvents.flags |= PM_EVT_SECOND_ELAPSED;
+    PM_TimerPost(&sTimers, TIMER_SECOND, PM_TICKS_PER_SEC);
+}
+
+_PRIVATE void super_pill_spawner(u8 index)
+{
+    // The super pill replaces the standard pill in its cell, if it's still there.
+    const PM_SuperPill *const pill = &sGame.super_pills[index];
+    maze_set(sGame.maze.pills, pill->cell, false);
+    maze_set(sGame.maze.super_pills, pill->cell, true);
+    sGame.super_pills_to_spawn--;
+
+    sEvents.flags |= PM_EVT_SUPER_PILL_SPAWNED;
+    sEvents.spawned_super_pill = index;
+}
+
+_PRIVATE void ghost_speed_up(void)
+{
+    // Every second till the last 20, we increase the speed of the ghosts by a little bit.
+    for (u8 i = 0; i < PM_GHOST_COUNT; i++)
+        sGame.ghosts[i].speed += sLevels[sLevel].ghost_ramp;
+
+    if (sGame.stat_values.game_over_in > 20)
+        PM_TimerPost(&sTimers, TIMER_GHOST_SPEED_UP, PM_TICKS_PER_SEC);
+}
+
+_PRIVATE void ghost_calm_down(void)
+{
+    for (u8 i = 0; i < PM_GHOST_COUNT; i++)
+        sGame.ghosts[i].is_scared = false;
+
+    sEvents.flags |= PM_EVT_GHOST_CALMED;
+}
+
+_PRIVATE void timers_runner(void)
+{
+    // The game time only elapses while playing: the countdown, the spawns and the scared
+    // ghost are frozen during the pause.
+    if (!sGame.playing_now)
+        return;
+
+    PM_TimerAdvance(&sTimers);
+
+    u8 id;
+    while (!sGame.is_over && PM_TimerNextDue(&sTimers, &id))
+    {
+        if (id == TIMER_SECOND)
+            second_elapsed();
+        else if (id < TIMER_SUPER_PILL + PM_SUP_PILL_COUNT)
+            super_pill_spawner(id - TIMER_SUPER_PILL);
+        else if (id == TIMER_GHOST_SPEED_UP)
+            ghost_speed_up();
+        else if (id == TIMER_GHOST_CALM)
+            ghost_calm_down();
+    }
+}
+
+// PUBLIC FUNCTIONS
+
+void PM_CoreNewGame(PM_Speed speed, u32 seed)
+{
+    sGame.stat_values = (PM_GameStatValues){
+        .pills_eaten = 0,
+        .game_over_in = 60,
+        .lives = 1,
+        .record = 0,
+        .score = 0,
+    };
+
+    // Laying the pills on the maze, so we can eat them without affecting the original.
+    reset_maze();
+    sLevel = speed;
+    const PM_MazeCell pacman_spawn = sTiles.pacman_spawn, ghost_spawn = sTiles.ghost_spawn;
+    sGame.pacman = (PM_PacMan){
+        .cell = pacman_spawn, .prev_cell = pacman_spawn, .dir = PM_MOV_NONE, .speed = sLevels[speed].pacman};
+
+    // Not scared, and with no path yet.
+    memset(sGhostGrid, 0, sizeof(sGhostGrid));
+    for (u8 i = 0; i < PM_GHOST_COUNT; i++)
+    {
+        sGame.ghosts[i] = (PM_Ghost){.cell = ghost_spawn, .prev_cell = ghost_spawn, .speed = sLevels[speed].ghost};
+        sGhostGrid[ghost_spawn.row][ghost_spawn.col] |= 1U << i;
+    }
+
+    init_super_pills(seed);
+
+    // Posting the timed events known from the start. The others are posted as they come.
+    PM_TimerInit(&sTimers);
+    PM_TimerPost(&sTimers, TIMER_SECOND, PM_TICKS_PER_SEC);
+    PM_TimerPost(&sTimers, TIMER_GHOST_SPEED_UP, PM_TICKS_PER_SEC);
+    for (u8 i = 0; i < PM_SUP_PILL_COUNT; i++)
+    {
+        const u16 secs = sGame.stat_values.game_over_in - sGame.super_pills[i].spawn_sec;
+        PM_TimerPost(&sTimers, TIMER_SUPER_PILL + i, secs * PM_TICKS_PER_SEC);
+    }
+
+    // Adding the jobs, in the order they run on each tick. PacMan and the ghost are paced by their speed.
+    // clang-format off
+    sJobs[JOB_PACMAN] = (CoreJob){pacman_mover, 1, 0};
+    sJobs[JOB_TIMERS] = (CoreJob){timers_runner, 1, 0};
+    sJobs[JOB_GHOST_AI] = (CoreJob){ghosts_ai, 1, 0};
+    // clang-format on
+
+    sGame.is_over = false;
+    sGame.playing_now = true;
+}
+
+PM_Events PM_CoreStep(PM_Input input)
+{
+    sEvents = (PM_Events){0};
+    if (sGame.is_over)
+        return sEvents;
+
+    // Toggling between playing or paused. PacMan stops either way.
+    if (input.toggle_pause)
+    {
+        sGame.playing_now = !sGame.playing_now;
+        sGame.pacman.dir = PM_MOV_NONE;
+        sGame.pacman.next_dir = PM_MOV_NONE;
+        sEvents.flags |= PM_EVT_PAUSE_TOGGLED;
+    }
+
+    // The direction is queued as a turn, taken by pacman_mover where it's legal, instead of being lost
+    // if asked for a little early. Asking for the direction PacMan already has cancels the turn queued.
+    if (sGame.playing_now && input.dir != PM_MOV_NONE)
+    {
+        PM_PacMan *const pacman = &sGame.pacman;
+        pacman->next_dir = (input.dir == pacman->dir) ? PM_MOV_NONE : input.dir;
+
+        // Standing still, he sets off on this very tick if he can, instead of waiting for his next step.
+        if (pacman->dir == PM_MOV_NONE && pacman->next_dir != PM_MOV_NONE && !pacman_is_blocked(pacman->next_dir))
+            pacman->step_acc = PM_SPEED_STEP - pacman->speed;
+    }
+
+    CoreJob *job;
+    for (u8 i = 0; i < JOB_COUNT && !sGame.is_over; i++)
+    {
+        job = &sJobs[i];
+        if (++job->elapsed >= job->period)
+        {
+            job->elapsed = 0;
+            job->run();
+        }
+    }
+
+    return sEvents;
+}
+
+bool PM_CoreIsInputIdle(PM_Input input)
+{
+    if (sGame.is_over)
+        return true;
+
+    if (input.toggle_pause)
+        return false;
+
+    // While paused the directions are ignored.
+    if (!sGame.playing_now || input.dir == PM_MOV_NONE)
+        return true;
+
+    // Otherwise, it's idle if it leaves the turn queued as it is.
+    const PM_MovementDir next_dir = (input.dir == sGame.pacman.dir) ? PM_MOV_NONE : input.dir;
+    return next_dir == sGame.pacman.next_dir;
+}
+
+const PM_Game *PM_CoreGetGame(void)
+{
+    return &sGame;
+}
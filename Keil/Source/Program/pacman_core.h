@@ -0,0 +1,54 @@
+#ifndef __PACMAN_CORE_H
+#define __PACMAN_CORE_H
+
+#include "pacman_types.h"
+
+/// @brief Input of a tick of the game.
+typedef struct
+{
+    PM_MovementDir dir; // Turn of PacMan, see PM_PacMan.next_dir. PM_MOV_NONE to keep the current one
+    bool toggle_pause;
+} PM_Input;
+
+/// @brief Events raised by a tick of the game, for the front end to update its view.
+typedef enum
+{
+    PM_EVT_PACMAN_MOVED = 0x1,
+    PM_EVT_GHOST_MOVED = 0x2,
+    PM_EVT_PILL_EATEN = 0x4,
+    PM_EVT_SUPER_PILL_EATEN = 0x8,
+    PM_EVT_SUPER_PILL_SPAWNED = 0x10,
+    PM_EVT_GHOST_SCARED = 0x20,
+    PM_EVT_GHOST_CALMED = 0x40,
+    PM_EVT_STATS_CHANGED = 0x80, // Score, record or lives
+    PM_EVT_SECOND_ELAPSED = 0x100,
+    PM_EVT_PAUSE_TOGGLED = 0x200,
+    PM_EVT_VICTORY = 0x400,
+    PM_EVT_DEFEAT = 0x800,
+    PM_EVT_NEW_RECORD = 0x1000, // Along with PM_EVT_VICTORY
+    PM_EVT_TURN_TAKEN = 0x2000, // PacMan took the direction asked for, now in PM_PacMan.dir
+    PM_EVT_LIFE_LOST = 0x4000,   // A ghost caught PacMan: both are back on their spawn cells, unless it's PM_EVT_DEFEAT
+    PM_EVT_GHOST_EATEN = 0x8000, // PacMan ate a scared ghost, which is back on its spawn cell and calmed down
+} PM_EventFlag;
+
+typedef struct
+{
+    u16 flags;             // PM_EventFlag values, OR'ed
+    PM_MazeCell pill_cell; // Cell of the pill eaten, for PM_EVT_PILL_EATEN and PM_EVT_SUPER_PILL_EATEN
+    u8 spawned_super_pill; // Index in PM_Game.super_pills, for PM_EVT_SUPER_PILL_SPAWNED
+} PM_Events;
+
+/// @brief Starts a new game on the base maze. Only prev_record is kept from the previous game.
+/// @param seed Seed of the positions and of the spawn times of the super pills. The same
+///        seed and the same inputs, tick by tick, always play the same game.
+void PM_CoreNewGame(PM_Speed speed, u32 seed);
+
+/// @brief Advances the game by a tick, i.e. PM_TICK_MS on the board. Once the game is over, it does nothing.
+PM_Events PM_CoreStep(PM_Input input);
+
+/// @brief Whether the input, given to the next tick, would play the same game as no input at all.
+bool PM_CoreIsInputIdle(PM_Input input);
+
+const PM_Game *PM_CoreGetGame(void);
+
+#endif
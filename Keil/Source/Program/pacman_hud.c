@@ -0,0 +1,122 @@
+#include "pacman_hud.h"
+
+// UTILS
+
+_PRIVATE inline u32 clamp_value(u32 value)
+{
+    return (value > PM_HUD_MAX_VALUE) ? PM_HUD_MAX_VALUE : value;
+}
+
+// PUBLIC FUNCTIONS
+
+u8 PM_HudFormat(u32 value, char *out)
+{
+    // The digits come out from the last one, so they're written backwards first.
+    char reversed[10];
+    u8 length = 0;
+    do
+    {
+        reversed[length++] = '0' + value % 10;
+        value /= 10;
+    } while (value);
+
+    for (u8 i = 0; i < length; i++)
+        out[i] = reversed[length - 1 - i];
+
+    return length;
+}
+
+u8 PM_HudDigitAdvance(const LCD_Font *const font, u8 char_spacing)
+{
+    u16 widest = 0;
+    for (char c = '0'; c <= '9'; c++)
+    {
+        if (font->char_widths[c - ASCII_FONT_MIN_VALUE] > widest)
+            widest = font->char_widths[c - ASCII_FONT_MIN_VALUE];
+    }
+
+    return widest + char_spacing;
+}
+
+LCD_Error PM_HudNumberInit(PM_HudNumber *const number, u32 value, LCD_Coordinate pos, LCD_FontID font, u8 advance,
+                           LCD_Color color)
+{
+    char digits[PM_HUD_MAX_DIGITS];
+    number->value = clamp_value(value);
+    number->length = PM_HudFormat(number->value, digits);
+    number->is_visible = true;
+
+    LCD_Error err, first_err = LCD_ERR_OK;
+    for (u8 i = 0; i < PM_HUD_MAX_DIGITS; i++)
+    {
+        number->digits[i][0] = (i < number->length) ? digits[i] : '0';
+        number->digits[i][1] = '\0';
+
+        // clang-format off
+        err = LCD_INVISIBLE_OBJECT(&number->digit_ids[i], {
+            LCD_TEXT2(pos.x + i * advance, pos.y, {
+                .text = number->digits[i], .font = font, .char_spacing = 0,
+                .text_color = color, .bg_color = LCD_COL_NONE,
+            }),
+        });
+        // clang-format on
+
+        if (err != LCD_ERR_OK)
+        {
+            first_err = (first_err == LCD_ERR_OK) ? err : first_err;
+            continue;
+        }
+
+        if (i < number->length)
+            LCD_RMSetVisibility(number->digit_ids[i], true, false);
+    }
+
+    return first_err;
+}
+
+void PM_HudNumberSet(PM_HudNumber *const number, u32 value)
+{
+    value = clamp_value(value);
+    if (value == number->value)
+        return;
+
+    char digits[PM_HUD_MAX_DIGITS];
+    const u8 length = PM_HudFormat(value, digits);
+    number->value = value;
+
+    // While hidden, the strings are brought up to date, and the digits are drawn once shown.
+    bool was_shown;
+    for (u8 i = 0; i < PM_HUD_MAX_DIGITS; i++)
+    {
+        was_shown = i < number->length;
+        if (i >= length)
+        {
+            if (was_shown && number->is_visible)
+                LCD_RMSetVisibility(number->digit_ids[i], false, false);
+
+            continue;
+        }
+
+        if (was_shown && number->digits[i][0] == digits[i])
+            continue;
+
+        if (was_shown && number->is_visible)
+            LCD_RMSetVisibility(number->digit_ids[i], false, false);
+
+        number->digits[i][0] = digits[i];
+        if (number->is_visible)
+            LCD_RMSetVisibility(number->digit_ids[i], true, false);
+    }
+
+    number->length = length;
+}
+
+void PM_HudNumberSetVisibility(PM_HudNumber *const number, bool visible)
+{
+    if (visible == number->is_visible)
+        return;
+
+    number->is_visible = visible;
+    for (u8 i = 0; i < number->length; i++)
+        LCD_RMSetVisibility(number->digit_ids[i], visible, false);
+}
@@ -0,0 +1,43 @@
+#ifndef __PACMAN_HUD_H
+#define __PACMAN_HUD_H
+
+#include "glcd.h"
+
+/// @brief Digits a HUD number can show, enough for any u16. Larger values show as PM_HUD_MAX_VALUE.
+#define PM_HUD_MAX_DIGITS 5
+#define PM_HUD_MAX_VALUE 99999
+
+/// @brief A number shown on the screen, bound to the value it shows. Each digit is a text
+///        object of its own, in a slot of fixed width, so that only the digits that change
+///        are redrawn, and only when the value changes.
+typedef struct
+{
+    LCD_ObjID digit_ids[PM_HUD_MAX_DIGITS];
+    char digits[PM_HUD_MAX_DIGITS][2]; // Strings shown by the digit objects
+    u8 length;                         // Digits of the value shown, the slots after it are hidden
+    u32 value;                         // Up to PM_HUD_MAX_VALUE
+    bool is_visible;
+} PM_HudNumber;
+
+/// @brief Writes the decimal digits of the value, without a terminator.
+/// @param out At least PM_HUD_MAX_DIGITS chars, or 10 for the largest u32 values.
+/// @return The number of digits written.
+u8 PM_HudFormat(u32 value, char *out);
+
+/// @brief Returns the width of the digit slots for a font: the widest digit, plus the spacing.
+u8 PM_HudDigitAdvance(const LCD_Font *const font, u8 char_spacing);
+
+/// @brief Creates the digit objects of a number, and draws it with the value given. The number
+///        must stay at the same address while it's drawn, since the objects refer to its strings.
+/// @param advance Pixels from a digit slot to the next one, i.e. the widest digit plus the spacing.
+/// @return The error of the first object that couldn't be created, if any.
+LCD_Error PM_HudNumberInit(PM_HudNumber *const number, u32 value, LCD_Coordinate pos, LCD_FontID font, u8 advance,
+                           LCD_Color color);
+
+/// @brief Binds the number to a new value, redrawing the digits that change, if any.
+void PM_HudNumberSet(PM_HudNumber *const number, u32 value);
+
+/// @brief Shows or hides the number, e.g. while the game is paused.
+void PM_HudNumberSetVisibility(PM_HudNumber *const number, bool visible);
+
+#endif
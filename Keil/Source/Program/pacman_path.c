@@ -0,0 +1,1107 @@
+#include "pacman_path.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// Images
+#include "Assets/Images/pacman-maze-nexthop.h"
+
+// The A* search serves every strategy but the flow field, either as the main one or as the fallback
+// of the next-hop table.
+#define PATH_USES_ASTAR (PM_GHOST_PATHING != PM_PATHING_FLOW_FIELD)
+
+// STATE VARIABLES
+
+_PRIVATE _PM_GAME_STATE const PM_MazeTiles *sMazeTiles;
+_PRIVATE _PM_GAME_STATE PM_MazeCell sPacMan;
+_PRIVATE _PM_GAME_STATE PM_PathStats sStats;
+
+// MAZE
+
+// Mask of the cells of a row that the ghosts can walk on, i.e. neither walls nor teleporters.
+_PRIVATE inline u32 maze_walkable_row(u16 row)
+{
+    return ~(sMazeTiles->walls[row] | sMazeTiles->portals[row]) & PM_MAZE_ROW_MASK;
+}
+
+// Whether the ghosts can move from the cell to the adjacent one along the direction (as an offset from PM_MOV_UP).
+_PRIVATE inline bool maze_can_step(PM_MazeCell cell, u8 dir)
+{
+    const u32 bit = PM_MAZE_BIT(cell.col);
+    switch (PM_MOV_UP + dir)
+    {
+    case PM_MOV_UP:
+        return cell.row > 0 && (maze_walkable_row(cell.row - 1) & bit);
+    case PM_MOV_DOWN:
+        return cell.row < PM_MAZE_SCALED_HEIGHT - 1 && (maze_walkable_row(cell.row + 1) & bit);
+    case PM_MOV_LEFT:
+        return maze_walkable_row(cell.row) & (bit >> 1);
+    case PM_MOV_RIGHT:
+        return maze_walkable_row(cell.row) & (bit << 1);
+    default:
+        return false;
+    }
+}
+
+_PRIVATE inline bool cells_equal(PM_MazeCell a, PM_MazeCell b)
+{
+    return a.row == b.row && a.col == b.col;
+}
+
+// Returns the cell adjacent to the given one along the direction. The cell must not be on the maze border.
+_PRIVATE inline PM_MazeCell cell_step(PM_MazeCell cell, PM_MovementDir dir)
+{
+    switch (dir)
+    {
+    case PM_MOV_UP:
+        return (PM_MazeCell){cell.row - 1, cell.col};
+    case PM_MOV_DOWN:
+        return (PM_MazeCell){cell.row + 1, cell.col};
+    case PM_MOV_LEFT:
+        return (PM_MazeCell){cell.row, cell.col - 1};
+    case PM_MOV_RIGHT:
+        return (PM_MazeCell){cell.row, cell.col + 1};
+    default:
+        return cell;
+    }
+}
+
+// Returns the direction (as an offset from PM_MOV_UP) from a cell to an adjacent one.
+_PRIVATE inline u8 cell_dir_to(PM_MazeCell from, PM_MazeCell to)
+{
+    if (to.row != from.row)
+        return (to.row < from.row) ? 0 : 1;
+
+    return (to.col < from.col) ? 2 : 3;
+}
+
+// GHOST PATHS
+
+_PRIVATE inline u8 ghost_path_get(const PM_GhostPath *const path, u8 index)
+{
+    const u8 slot = (path->head + index) % PM_GHOST_PATH_CAPACITY;
+    return (path->steps[slot / 4] >> (2 * (slot % 4))) & 0x3;
+}
+
+#if PATH_USES_ASTAR
+_PRIVATE void ghost_path_clear(PM_GhostPath *const path, PM_MazeCell start)
+{
+    path->start = start;
+    path->head = path->length = 0;
+    path->is_truncated = false;
+}
+
+// Appends a step to the path. If the buffer is full, the step is dropped and the path gets truncated.
+_PRIVATE bool ghost_path_push_back(PM_GhostPath *const path, u8 dir)
+{
+    if (path->length == PM_GHOST_PATH_CAPACITY)
+    {
+        path->is_truncated = true;
+        return false;
+    }
+
+    const u8 slot = (path->head + path->length++) % PM_GHOST_PATH_CAPACITY;
+    path->steps[slot / 4] &= ~(0x3 << (2 * (slot % 4)));
+    path->steps[slot / 4] |= dir << (2 * (slot % 4));
+    return true;
+}
+
+// Removes the first step from the path, and returns the cell it leads to, which the path starts from now.
+_PRIVATE PM_MazeCell ghost_path_pop_front(PM_GhostPath *const path)
+{
+    path->start = cell_step(path->start, (PM_MovementDir)(PM_MOV_UP + ghost_path_get(path, 0)));
+    path->head = (path->head + 1) % PM_GHOST_PATH_CAPACITY;
+    path->length--;
+    return path->start;
+}
+#endif
+
+// JUNCTION GRAPH
+
+// Sentinel for "no junction", in the junction graph and in the index-linked structures of the A* search.
+#define JUNCTION_NIL 0xFF
+
+// Capacity of the junction graph. The base maze has 92 junctions, dead ends included.
+#define JUNCTION_MAX_NODES 128
+
+// Each corridor is stored once per direction of travel, and takes a step per inner cell, plus the last
+// one into the junction at its end. Each corridor has two ends, so there are at most 2 per junction.
+#define JUNCTION_MAX_STEPS (2 * (PM_MAZE_CELL_COUNT + 2 * JUNCTION_MAX_NODES))
+
+typedef struct
+{
+    PM_MazeCell cell;
+
+    // Corridors leaving the junction, indexed by direction (as an offset from PM_MOV_UP).
+    u8 next[4];    // Junction at the other end, JUNCTION_NIL if there's no way out along the direction
+    u16 length[4]; // Number of steps to reach it
+    u16 steps[4];  // Index of the first step of the corridor in the step pool
+} JunctionNode;
+
+// Compressed view of the maze for the pathfinding of the ghosts. Most walkable cells are corridor cells,
+// with exactly two walkable neighbors, where a ghost can only go on till the end of the corridor. The
+// nodes of the graph are the other cells (intersections and dead ends), and the edges are the corridors
+// between them, each with its length and the sequence of directions that walks it (2 bits per step).
+typedef struct
+{
+    JunctionNode nodes[JUNCTION_MAX_NODES];
+    u8 node_count;
+    u8 node_of[PM_MAZE_SCALED_HEIGHT][PM_MAZE_SCALED_WIDTH]; // JUNCTION_NIL for walls and corridor cells
+    u8 steps[JUNCTION_MAX_STEPS / 4];
+    u16 step_count;
+} JunctionGraph;
+
+_PRIVATE _PM_GAME_STATE JunctionGraph sJunctions;
+
+_PRIVATE inline u8 junction_step(u16 index)
+{
+    return (sJunctions.steps[index / 4] >> (2 * (index % 4))) & 0x3;
+}
+
+// Returns the way out of a corridor cell that doesn't lead back, given the direction the cell was
+// entered along. In a corridor there's only one; at a junction, the direction is meaningless.
+_PRIVATE u8 corridor_next_dir(PM_MazeCell cell, u8 dir)
+{
+    const u8 back = dir ^ 1; // Up <-> Down, Left <-> Right
+    for (u8 next_dir = 0; next_dir < 4; next_dir++)
+        if (next_dir != back && maze_can_step(cell, next_dir))
+            return next_dir;
+
+    return dir;
+}
+
+// Moves the cell one step along the corridor, updating the direction to keep following it.
+_PRIVATE inline void corridor_advance(PM_MazeCell *cell, u8 *dir)
+{
+    *cell = cell_step(*cell, (PM_MovementDir)(PM_MOV_UP + *dir));
+    *dir = corridor_next_dir(*cell, *dir);
+}
+
+_PRIVATE bool add_junction(PM_MazeCell cell, PM_MazeRows covered)
+{
+    if (sJunctions.node_count == JUNCTION_MAX_NODES)
+        return false;
+
+    sJunctions.node_of[cell.row][cell.col] = sJunctions.node_count;
+    sJunctions.nodes[sJunctions.node_count++] = (JunctionNode){
+        .cell = cell,
+        .next = {JUNCTION_NIL, JUNCTION_NIL, JUNCTION_NIL, JUNCTION_NIL},
+    };
+
+    covered[cell.row] |= PM_MAZE_BIT(cell.col);
+    return true;
+}
+
+// Walks every corridor leaving the junction till the next one, storing its length and its steps.
+_PRIVATE void trace_corridors(u8 node, PM_MazeRows covered)
+{
+    JunctionNode *const junction = &sJunctions.nodes[node];
+    PM_MazeCell cell;
+    u8 cur_dir;
+    for (u8 dir = 0; dir < 4; dir++)
+    {
+        if (!maze_can_step(junction->cell, dir))
+            continue;
+
+        cell = junction->cell;
+        cur_dir = dir;
+        junction->steps[dir] = sJunctions.step_count;
+        junction->length[dir] = 0;
+        do
+        {
+            sJunctions.steps[sJunctions.step_count / 4] |= cur_dir << (2 * (sJunctions.step_count % 4));
+            sJunctions.step_count++;
+            junction->length[dir]++;
+
+            corridor_advance(&cell, &cur_dir);
+            covered[cell.row] |= PM_MAZE_BIT(cell.col);
+        } while (sJunctions.node_of[cell.row][cell.col] == JUNCTION_NIL);
+
+        junction->next[dir] = sJunctions.node_of[cell.row][cell.col];
+    }
+}
+
+/*
+Builds the junction graph of the tiles loaded in sMazeTiles. The junctions are the walkable cells that
+don't have exactly two walkable neighbors, and the corridors leaving each of them are walked till the next
+junction. A corridor closing on itself, with no junction along it, gets one of its cells promoted to
+junction, so that every walkable cell belongs to the graph. Returns false if there are too many junctions.
+*/
+_PRIVATE bool find_junctions(void)
+{
+    PM_MazeRows covered = {0};
+
+    memset(&sJunctions, 0, sizeof(sJunctions));
+    memset(sJunctions.node_of, JUNCTION_NIL, sizeof(sJunctions.node_of));
+
+    PM_MazeCell cell;
+    u8 degree;
+    for (u16 row = 0; row < PM_MAZE_SCALED_HEIGHT; row++)
+    {
+        for (u32 bits = maze_walkable_row(row); bits; bits &= bits - 1)
+        {
+            cell = (PM_MazeCell){row, __builtin_ctz(bits)};
+
+            degree = 0;
+            for (u8 dir = 0; dir < 4; dir++)
+                degree += maze_can_step(cell, dir);
+
+            if (degree != 2 && !add_junction(cell, covered))
+                return false;
+        }
+    }
+
+    for (u8 node = 0, count = sJunctions.node_count; node < count; node++)
+        trace_corridors(node, covered);
+
+    // Any walkable cell not covered yet is on a corridor closing on itself.
+    u32 bits;
+    for (u16 row = 0; row < PM_MAZE_SCALED_HEIGHT; row++)
+    {
+        while ((bits = maze_walkable_row(row) & ~covered[row]))
+        {
+            if (!add_junction((PM_MazeCell){row, __builtin_ctz(bits)}, covered))
+                return false;
+
+            trace_corridors(sJunctions.node_count - 1, covered);
+        }
+    }
+
+    return true;
+}
+
+_PRIVATE void build_junction_graph(void)
+{
+    // Without the graph, the ghosts can only rely on the next-hop table and the flow field.
+    if (!find_junctions())
+        sJunctions.node_count = 0;
+}
+
+// A* SEARCH
+
+// Marks the goal as not reached (yet), and the cells that are not along a path.
+#define ASTAR_NO_COST 0xFFFF
+
+// Upper bound (excluded) of the f values: g is at most the number of cells, and h
+// (the Manhattan distance) at most the sum of the maze dimensions.
+#define ASTAR_MAX_F (PM_MAZE_CELL_COUNT + PM_MAZE_SCALED_WIDTH + PM_MAZE_SCALED_HEIGHT)
+
+typedef struct
+{
+    // f = g + h
+    // g = cost to reach the junction from the root of the search
+    // h = heuristic function (Manhattan distance in this case)
+    u16 f, g;
+    u8 parent;      // Previous junction along the path, JUNCTION_NIL if reached straight from the root
+    u8 parent_dir;  // Direction taken when leaving the parent (or the root) towards the junction
+    u8 prev, next;  // Links to the other junctions queued in the same bucket
+    u16 generation; // Search that last reached the node. If outdated, the node is unreached.
+    bool open, closed;
+} AStarNode;
+
+typedef enum
+{
+    ASTAR_FOUND,
+    ASTAR_PENDING, // The expansion budget ran out: the search is resumed by the next call
+    ASTAR_NO_PATH,
+} AStarStatus;
+
+// A way to the goal that doesn't pass by any other junction: from one of the junctions at the
+// ends of its corridor, or straight from the root of the search, if it lies on the same corridor.
+typedef struct
+{
+    u8 node; // JUNCTION_NIL for the root
+    u8 dir;  // Direction to take from there
+    u16 distance;
+} AStarGoalLink;
+
+// The search runs on the junction graph. The open set is a bucket queue: each bucket is a LIFO
+// list of the open junctions sharing the same f value. The lists are intrusive (linked through the
+// junction indices), so that the whole search state is statically sized, and no memory is taken
+// from the allocator.
+//
+// The state is kept between searches: walls never change, so the g values of the closed junctions
+// remain the exact distances from the root whatever the goal is. When only the goal changes, the open
+// junctions are re-prioritized with the new heuristic and the search is resumed.
+typedef struct
+{
+    AStarNode nodes[JUNCTION_MAX_NODES];
+    u8 buckets[ASTAR_MAX_F];
+    u16 min_f, open_count;
+    u16 generation;
+    bool has_tree;
+
+    PM_MazeCell root, goal;
+    AStarGoalLink links[3]; // Up to 2 junctions, plus the root
+    u8 link_count;
+    u8 goal_link;  // Link of the shortest path found to the goal
+    u16 goal_cost; // Its length, ASTAR_NO_COST if the goal hasn't been reached yet
+} AStarSearch;
+
+_PRIVATE _PM_GAME_STATE AStarSearch sAStar;
+
+_PRIVATE inline u16 cell_to_index(PM_MazeCell cell)
+{
+    return cell.row * PM_MAZE_SCALED_WIDTH + cell.col;
+}
+
+_PRIVATE inline PM_MazeCell index_to_cell(u16 index)
+{
+    return (PM_MazeCell){index / PM_MAZE_SCALED_WIDTH, index % PM_MAZE_SCALED_WIDTH};
+}
+
+// Using the Manhattan distance as the heuristic function for the A* algorithm.
+// The Manhattan distance is the sum of the absolute differences of the x and y
+// coordinates of the two points. It is a good heuristic for this game, since
+// the ghosts can only move in 4 directions, and the maze is a grid. It's never
+// greater than the length of a corridor between the two cells, either.
+_PRIVATE inline u16 heuristic(PM_MazeCell a, PM_MazeCell b)
+{
+    return abs(a.row - b.row) + abs(a.col - b.col);
+}
+
+// Drops the search tree, e.g. because the maze it was built on has been replaced.
+_PRIVATE void astar_reset(void)
+{
+    sAStar.has_tree = false;
+}
+
+#if PATH_USES_ASTAR
+// Whether the node has been reached by the current search.
+_PRIVATE inline bool astar_reached(u8 index)
+{
+    return sAStar.nodes[index].generation == sAStar.generation;
+}
+
+_PRIVATE void astar_enqueue(u8 index, u16 f)
+{
+    AStarNode *const node = &sAStar.nodes[index];
+    u8 *const head = &sAStar.buckets[f];
+
+    node->f = f;
+    node->open = true;
+    node->prev = JUNCTION_NIL;
+    node->next = *head;
+    if (*head != JUNCTION_NIL)
+        sAStar.nodes[*head].prev = index;
+
+    *head = index;
+    if (!sAStar.open_count++ || f < sAStar.min_f)
+        sAStar.min_f = f;
+}
+
+_PRIVATE void astar_unlink(u8 index)
+{
+    AStarNode *const node = &sAStar.nodes[index];
+    if (node->prev != JUNCTION_NIL)
+        sAStar.nodes[node->prev].next = node->next;
+    else
+        sAStar.buckets[node->f] = node->next;
+
+    if (node->next != JUNCTION_NIL)
+        sAStar.nodes[node->next].prev = node->prev;
+
+    node->open = false;
+    sAStar.open_count--;
+}
+
+// Lowest f value in the open set, which must not be empty.
+_PRIVATE u16 astar_min_f(void)
+{
+    while (sAStar.buckets[sAStar.min_f] == JUNCTION_NIL)
+        sAStar.min_f++;
+
+    return sAStar.min_f;
+}
+
+// Pops the most recently queued node among the ones with the lowest f value. Preferring the
+// last one breaks ties in favor of the deepest nodes, i.e. the ones closer to the goal.
+_PRIVATE u8 astar_dequeue(void)
+{
+    const u8 head = sAStar.buckets[astar_min_f()];
+    astar_unlink(head);
+    return head;
+}
+
+// Offers a path of cost g to the junction, coming from the parent (or the root) along the direction.
+_PRIVATE void astar_relax(u8 index, u16 g, u8 parent, u8 parent_dir)
+{
+    AStarNode *const node = &sAStar.nodes[index];
+
+    // If the junction hasn't been reached yet during this search, it's initialized now.
+    if (!astar_reached(index))
+        *node = (AStarNode){.generation = sAStar.generation};
+    else if (node->closed || g >= node->g)
+        return; // Already evaluated, or not an improvement.
+    else if (node->open)
+        astar_unlink(index); // Moving it to the bucket of its new f value.
+
+    node->g = g;
+    node->parent = parent;
+    node->parent_dir = parent_dir;
+    astar_enqueue(index, g + heuristic(sJunctions.nodes[index].cell, sAStar.goal));
+}
+
+// Looks for a shorter path to the goal among its links: the one from the root, and the ones from the
+// junctions reached so far. Their distance from the root may still improve while they're open, but
+// it's the length of an actual path, so the best one found is a valid bound to stop the search.
+_PRIVATE void astar_check_links(void)
+{
+    const AStarGoalLink *link;
+    u16 cost;
+    for (u8 i = 0; i < sAStar.link_count; i++)
+    {
+        link = &sAStar.links[i];
+        if (link->node == JUNCTION_NIL)
+            cost = link->distance;
+        else if (astar_reached(link->node))
+            cost = sAStar.nodes[link->node].g + link->distance;
+        else
+            continue;
+
+        if (cost < sAStar.goal_cost)
+        {
+            sAStar.goal_cost = cost;
+            sAStar.goal_link = i;
+        }
+    }
+}
+
+// Finds the links of the goal to the graph: the goal itself if it's a junction, otherwise the
+// junctions at the ends of its corridor, and the root, if met along the way. This is the only
+// part of the search that walks on the cells, and it's bounded by the length of the corridor.
+_PRIVATE void astar_locate_goal(PM_MazeCell goal)
+{
+    sAStar.goal = goal;
+    sAStar.goal_cost = ASTAR_NO_COST;
+    sAStar.link_count = 0;
+
+    const u8 goal_node = sJunctions.node_of[goal.row][goal.col];
+    if (goal_node != JUNCTION_NIL || cells_equal(goal, sAStar.root))
+        sAStar.links[sAStar.link_count++] = (AStarGoalLink){goal_node, 0, 0};
+    else
+    {
+        PM_MazeCell cell;
+        u8 cur_dir, step_dir;
+        u16 distance;
+        for (u8 dir = 0; dir < 4; dir++)
+        {
+            if (!maze_can_step(goal, dir))
+                continue;
+
+            cell = goal;
+            cur_dir = dir;
+            distance = 0;
+            do
+            {
+                step_dir = cur_dir;
+                corridor_advance(&cell, &cur_dir);
+                distance++;
+
+                // The links store the way from the other end, hence the steps are reversed.
+                if (cells_equal(cell, sAStar.root) && sJunctions.node_of[cell.row][cell.col] == JUNCTION_NIL)
+                    sAStar.links[sAStar.link_count++] = (AStarGoalLink){JUNCTION_NIL, step_dir ^ 1, distance};
+            } while (sJunctions.node_of[cell.row][cell.col] == JUNCTION_NIL);
+
+            sAStar.links[sAStar.link_count++] =
+                (AStarGoalLink){sJunctions.node_of[cell.row][cell.col], step_dir ^ 1, distance};
+        }
+    }
+
+    astar_check_links();
+}
+
+// Starts a new search tree rooted at the given cell. The nodes of the previous search are
+// invalidated in O(1), by bumping the generation counter: the node array is only cleared
+// when the counter wraps around.
+_PRIVATE void astar_start(PM_MazeCell root, PM_MazeCell goal)
+{
+    sStats.restarts++;
+    if (++sAStar.generation == 0)
+    {
+        memset(sAStar.nodes, 0, sizeof(sAStar.nodes));
+        sAStar.generation = 1;
+    }
+
+    memset(sAStar.buckets, JUNCTION_NIL, sizeof(sAStar.buckets));
+    sAStar.open_count = 0;
+    sAStar.has_tree = true;
+    sAStar.root = root;
+    sAStar.goal = goal;
+
+    // If the root is a corridor cell, the search starts from the junctions at the ends of its corridor.
+    const u8 root_node = sJunctions.node_of[root.row][root.col];
+    if (root_node != JUNCTION_NIL)
+        astar_relax(root_node, 0, JUNCTION_NIL, 0);
+    else
+    {
+        PM_MazeCell cell;
+        u8 cur_dir;
+        u16 distance;
+        for (u8 dir = 0; dir < 4; dir++)
+        {
+            if (!maze_can_step(root, dir))
+                continue;
+
+            cell = root;
+            cur_dir = dir;
+            distance = 0;
+            do
+            {
+                corridor_advance(&cell, &cur_dir);
+                distance++;
+            } while (sJunctions.node_of[cell.row][cell.col] == JUNCTION_NIL);
+
+            astar_relax(sJunctions.node_of[cell.row][cell.col], distance, JUNCTION_NIL, dir);
+        }
+    }
+
+    astar_locate_goal(goal);
+}
+
+// Re-prioritizes the open nodes for a new goal. The closed nodes are left untouched.
+_PRIVATE void astar_retarget(PM_MazeCell goal)
+{
+    // Detaching all the open nodes in a single chain, then queueing them again with the new heuristic.
+    u8 chain = JUNCTION_NIL, index;
+    for (u16 f = sAStar.min_f; sAStar.open_count; f++)
+    {
+        while ((index = sAStar.buckets[f]) != JUNCTION_NIL)
+        {
+            astar_unlink(index);
+            sAStar.nodes[index].next = chain;
+            chain = index;
+        }
+    }
+
+    sAStar.goal = goal;
+    while (chain != JUNCTION_NIL)
+    {
+        index = chain;
+        chain = sAStar.nodes[index].next;
+        astar_enqueue(index, sAStar.nodes[index].g + heuristic(sJunctions.nodes[index].cell, goal));
+    }
+
+    astar_locate_goal(goal);
+}
+
+/*
+Using the A* algorithm to find the shortest path from the root of the search to the goal cell. A*
+selects the path that minimizes the cost function f = g + h, where g is the cost to reach the junction
+from the root, and h is the heuristic function (in this case, the Manhattan distance), that estimates
+the cost to reach the goal from the junction. Moving along a corridor costs its length.
+
+The algorithm uses two lists:
+    - Open list: Contains the junctions that need to be evaluated. Initially, it only contains the root,
+      or the two junctions at the ends of its corridor.
+    - Closed list: Contains the junctions that have already been evaluated. Initially, it is empty.
+
+The open list is implemented as a bucket queue (see AStarSearch), where the junction having the smallest
+f value has the highest priority, thus it will be dequeued first. Both insertion and extraction are O(1),
+and a junction whose cost improves while queued is moved to its new bucket instead of being queued twice.
+Each time a junction linked to the goal is reached, the path through it bounds the cost of the best one.
+The algorithm finishes when:
+    - The open list is empty
+    - The lowest f value in the open list is not lower than the cost of the best path to the goal.
+
+The heuristic never overestimates, so in the latter case no open junction can lead to a shorter path:
+the path has been found, and it can be rebuilt from the goal link backtracking the parents till the root.
+If the former happens before any link is evaluated, there's no path to the goal cell from the root.
+
+Each call expands at most as many junctions as the budget allows, so that the time spent searching on
+each tick is bounded. If the budget runs out first, the search can be resumed by calling again.
+*/
+_PRIVATE AStarStatus astar_expand_to(PM_MazeCell goal, u16 *budget)
+{
+    if (!cells_equal(goal, sAStar.goal))
+        astar_retarget(goal);
+
+    // Iterating while the open set may hold a better path.
+    AStarNode *cur_node;
+    const JunctionNode *junction;
+    u8 cur_index;
+    while (sAStar.open_count && astar_min_f() < sAStar.goal_cost)
+    {
+        if (!*budget)
+            return ASTAR_PENDING;
+
+        (*budget)--;
+        sStats.expansions++;
+
+        // Retrieving the junction with the lowest f value from the open set, and adding it to the closed set.
+        cur_index = astar_dequeue();
+        cur_node = &sAStar.nodes[cur_index];
+        cur_node->closed = true;
+
+        // Expanding the corridors leaving it, even if it's linked to the goal: every closed node must have been
+        // expanded, otherwise the junctions reachable only through it would get wrong costs when resuming.
+        junction = &sJunctions.nodes[cur_index];
+        for (u8 dir = 0; dir < 4; dir++)
+            if (junction->next[dir] != JUNCTION_NIL)
+                astar_relax(junction->next[dir], cur_node->g + junction->length[dir], cur_index, dir);
+
+        astar_check_links();
+    }
+
+    return (sAStar.goal_cost != ASTAR_NO_COST) ? ASTAR_FOUND : ASTAR_NO_PATH;
+}
+
+typedef struct
+{
+    PM_MazeCell cell, from;
+    PM_GhostPath *out;
+    u16 length; // Steps taken after the cell `from`, ASTAR_NO_COST till it's met
+} AStarPathWalk;
+
+_PRIVATE inline void path_walk_step(AStarPathWalk *walk, u8 dir)
+{
+    walk->cell = cell_step(walk->cell, (PM_MovementDir)(PM_MOV_UP + dir));
+    if (walk->length != ASTAR_NO_COST)
+    {
+        walk->length++;
+        if (walk->out)
+            ghost_path_push_back(walk->out, dir);
+    }
+    else if (cells_equal(walk->cell, walk->from))
+        walk->length = 0;
+}
+
+// Follows a corridor for some steps, finding the way on the maze.
+_PRIVATE void path_walk_corridor(AStarPathWalk *walk, u8 dir, u16 steps)
+{
+    while (steps--)
+    {
+        path_walk_step(walk, dir);
+        dir = corridor_next_dir(walk->cell, dir);
+    }
+}
+
+// Follows the corridor leaving a junction for some steps, reading the way from the graph.
+_PRIVATE void path_walk_steps(AStarPathWalk *walk, u8 node, u8 dir, u16 steps)
+{
+    const u16 first = sJunctions.nodes[node].steps[dir];
+    for (u16 i = 0; i < steps; i++)
+        path_walk_step(walk, junction_step(first + i));
+}
+
+/*
+Walks the path found by the search, from the root to the goal: the corridor of the root till the first
+junction, the corridors between the junctions, and finally the link to the goal. Returns the number of
+steps from the given cell to the goal, or ASTAR_NO_COST if the path doesn't pass by it. If a ghost
+path is given, the steps after the given cell are appended to it.
+*/
+_PRIVATE u16 astar_walk_path(PM_MazeCell from, PM_GhostPath *out)
+{
+    static _PM_GAME_STATE u8 chain[JUNCTION_MAX_NODES];
+
+    AStarPathWalk walk = {.cell = sAStar.root, .from = from, .out = out, .length = ASTAR_NO_COST};
+    if (cells_equal(walk.cell, from))
+        walk.length = 0;
+
+    const AStarGoalLink *const link = &sAStar.links[sAStar.goal_link];
+    if (link->node == JUNCTION_NIL)
+    {
+        path_walk_corridor(&walk, link->dir, link->distance);
+        return walk.length;
+    }
+
+    // Collecting the junctions along the path, from the goal back to the root.
+    u8 count = 0;
+    for (u8 index = link->node; index != JUNCTION_NIL; index = sAStar.nodes[index].parent)
+        chain[count++] = index;
+
+    // The corridor of the root is not in the graph. If the root is a junction, it's 0 steps long.
+    const AStarNode *node = &sAStar.nodes[chain[count - 1]];
+    path_walk_corridor(&walk, node->parent_dir, node->g);
+
+    for (; count > 1; count--)
+    {
+        node = &sAStar.nodes[chain[count - 2]];
+        path_walk_steps(&walk, chain[count - 1], node->parent_dir,
+                        sJunctions.nodes[chain[count - 1]].length[node->parent_dir]);
+    }
+
+    path_walk_steps(&walk, link->node, link->dir, link->distance);
+    return walk.length;
+}
+
+/*
+Makes sure that the search tree holds a shortest path from start to goal, reusing the previous search
+whenever possible, and returns its length. Any subpath of a shortest path is a shortest path too, so
+the tree can be kept as long as the start cell lies on the path from the root to the goal: this is
+always the case while the ghost walks along its path and PacMan moves away from it one cell at a time.
+In steady state, repairing the path costs a handful of expansions at most. Otherwise, a new tree is
+rooted at the start cell.
+
+The search is time-sliced: each call expands at most PM_ASTAR_EXPANSIONS_PER_TICK junctions, and returns
+ASTAR_PENDING if that's not enough. The next call resumes it, even if the start or the goal moved meanwhile.
+*/
+_PRIVATE AStarStatus find_path_to_goal(PM_MazeCell start, PM_MazeCell goal, u16 *out_length)
+{
+    if (!sJunctions.node_count)
+        return ASTAR_NO_PATH;
+
+    sStats.searches++;
+    u16 budget = PM_ASTAR_EXPANSIONS_PER_TICK;
+    if (!sAStar.has_tree)
+        astar_start(start, goal);
+
+    AStarStatus status = astar_expand_to(goal, &budget);
+    if (status == ASTAR_PENDING)
+        return ASTAR_PENDING;
+
+    if (status == ASTAR_FOUND && (*out_length = astar_walk_path(start, NULL)) != ASTAR_NO_COST)
+        return ASTAR_FOUND;
+
+    // If the tree is already rooted at the start, the goal is just out of reach.
+    if (status == ASTAR_NO_PATH && cells_equal(sAStar.root, start))
+        return ASTAR_NO_PATH;
+
+    astar_start(start, goal);
+    status = astar_expand_to(goal, &budget);
+    *out_length = sAStar.goal_cost;
+    return status;
+}
+
+// Once the path has been found, we can reconstruct it from the start cell (excluded) by walking
+// it from the root of the search, that is either the start cell itself, or a cell before it.
+_PRIVATE void reconstruct_path(PM_GhostPath *const path, PM_MazeCell start)
+{
+    ghost_path_clear(path, start);
+    astar_walk_path(start, path);
+}
+#endif
+
+// FLOW FIELD
+
+// Marks the cells that can't be reached from PacMan in the flow field.
+#define FLOW_FIELD_UNREACHED 0xFFFF
+
+// Marks the side of PacMan's own cell, and of the cells that he can't reach.
+#define FLOW_FIELD_NO_SIDE 0xFF
+
+// Breadth-first distance map from PacMan, shared by all the ghosts. It is recomputed on the first read
+// after PacMan changes cell, hence its cost doesn't depend on the number of ghosts reading it, and a
+// chase that never reads it doesn't pay for it.
+typedef struct
+{
+    u16 distance[PM_MAZE_SCALED_HEIGHT][PM_MAZE_SCALED_WIDTH];
+    u8 side[PM_MAZE_SCALED_HEIGHT][PM_MAZE_SCALED_WIDTH]; // First step of PacMan towards the cell
+} FlowField;
+
+_PRIVATE _PM_GAME_STATE FlowField sFlowField;
+_PRIVATE _PM_GAME_STATE bool sFlowFieldStale; // PacMan moved since the field was computed
+
+_PRIVATE void update_flow_field(PM_MazeCell pacman)
+{
+    static _PM_GAME_STATE u16 queue[PM_MAZE_CELL_COUNT];
+    memset(sFlowField.distance, 0xFF, sizeof(sFlowField.distance)); // FLOW_FIELD_UNREACHED
+    memset(sFlowField.side, FLOW_FIELD_NO_SIDE, sizeof(sFlowField.side));
+
+    u16 head = 0, tail = 0, distance;
+    sFlowField.distance[pacman.row][pacman.col] = 0;
+    queue[tail++] = cell_to_index(pacman);
+
+    PM_MazeCell cell, next;
+    u8 side;
+    while (head < tail)
+    {
+        cell = index_to_cell(queue[head++]);
+        distance = sFlowField.distance[cell.row][cell.col] + 1;
+        side = sFlowField.side[cell.row][cell.col];
+
+        for (u8 dir = 0; dir < 4; dir++)
+        {
+            if (!maze_can_step(cell, dir))
+                continue;
+
+            next = cell_step(cell, (PM_MovementDir)(PM_MOV_UP + dir));
+            if (sFlowField.distance[next.row][next.col] != FLOW_FIELD_UNREACHED)
+                continue;
+
+            // The cells next to PacMan start a side, the others inherit it.
+            sFlowField.distance[next.row][next.col] = distance;
+            sFlowField.side[next.row][next.col] = (side == FLOW_FIELD_NO_SIDE) ? dir : side;
+            queue[tail++] = cell_to_index(next);
+        }
+    }
+}
+
+// Brings the flow field up to date with the cell of PacMan, if he moved since it was last computed.
+_PRIVATE inline void refresh_flow_field(void)
+{
+    if (!sFlowFieldStale)
+        return;
+
+    update_flow_field(sPacMan);
+    sFlowFieldStale = false;
+}
+
+#if PM_GHOST_PATHING == PM_PATHING_FLOW_FIELD
+// Generates the neighbors of a cell in the maze, paying attention to the maze boundaries (e.g. walls).
+// The walls and the teleporters are masked out of the rows, so each direction is a single bit test.
+_PRIVATE void neighbors_finder(PM_MazeCell cell, PM_MazeCell *out_neighbors_arr, u8 *out_neighbors_sz)
+{
+    const u32 bit = PM_MAZE_BIT(cell.col), row = maze_walkable_row(cell.row);
+
+    *out_neighbors_sz = 0;
+    if (cell.row > 0 && (maze_walkable_row(cell.row - 1) & bit)) // Up
+        out_neighbors_arr[(*out_neighbors_sz)++] = (PM_MazeCell){cell.row - 1, cell.col};
+    if (cell.row < PM_MAZE_SCALED_HEIGHT - 1 && (maze_walkable_row(cell.row + 1) & bit)) // Down
+        out_neighbors_arr[(*out_neighbors_sz)++] = (PM_MazeCell){cell.row + 1, cell.col};
+    if (row & (bit >> 1)) // Left, the shift drops column 0
+        out_neighbors_arr[(*out_neighbors_sz)++] = (PM_MazeCell){cell.row, cell.col - 1};
+    if (row & (bit << 1)) // Right, the mask drops the last column
+        out_neighbors_arr[(*out_neighbors_sz)++] = (PM_MazeCell){cell.row, cell.col + 1};
+}
+
+// Moves down the flow field towards PacMan, or up the field away from him if fleeing. When fleeing,
+// the ghost stops in the cells that are locally the farthest from PacMan, till he gets closer.
+_PRIVATE bool flow_field_step(PM_MazeCell from, bool flee, PM_MazeCell *out_next)
+{
+    refresh_flow_field();
+    u16 best = sFlowField.distance[from.row][from.col], distance;
+    if (best == FLOW_FIELD_UNREACHED)
+        return false;
+
+    PM_MazeCell neighs[4];
+    u8 neigh_count;
+    bool found = false;
+    neighbors_finder(from, neighs, &neigh_count);
+    for (u8 i = 0; i < neigh_count; i++)
+    {
+        distance = sFlowField.distance[neighs[i].row][neighs[i].col];
+        if (flee ? distance > best : distance < best)
+        {
+            best = distance;
+            *out_next = neighs[i];
+            found = true;
+        }
+    }
+
+    return found;
+}
+#endif
+
+// FLEE TARGETS
+
+#if PATH_USES_ASTAR
+// For each cell PacMan may be in, and for each of his ways out of it, the safest junction to flee to among
+// the ones he reaches through that way out. A scared ghost picks the one on its own side of PacMan, so that
+// its way there doesn't cross him. The table is built once per maze: fleeing costs a lookup per tick.
+_PRIVATE _PM_GAME_STATE u8 sFleeTargets[PM_MAZE_SCALED_HEIGHT][PM_MAZE_SCALED_WIDTH][4];
+
+// Ranks the junctions as flee targets: the farther from PacMan by actual maze distance, the safer. Dead
+// ends come after all the intersections, since a ghost cornered there has no way out.
+_PRIVATE inline u32 flee_safety(u8 node)
+{
+    const JunctionNode *const junction = &sJunctions.nodes[node];
+
+    u8 ways_out = 0;
+    for (u8 dir = 0; dir < 4; dir++)
+        ways_out += (junction->next[dir] != JUNCTION_NIL);
+
+    return ((u32)(ways_out > 1) << 16) | sFlowField.distance[junction->cell.row][junction->cell.col];
+}
+
+// Fills the flee target table of the tiles in sMazeTiles, with a flow field from each walkable cell.
+// The flow field is left dirty, and must be marked stale afterwards.
+_PRIVATE void build_flee_targets(void)
+{
+    memset(sFleeTargets, JUNCTION_NIL, sizeof(sFleeTargets));
+
+    PM_MazeCell pacman, cell;
+    u32 safety, best[4];
+    u8 side;
+    for (u16 row = 0; row < PM_MAZE_SCALED_HEIGHT; row++)
+    {
+        for (u32 bits = maze_walkable_row(row); bits; bits &= bits - 1)
+        {
+            pacman = (PM_MazeCell){row, __builtin_ctz(bits)};
+            update_flow_field(pacman);
+
+            memset(best, 0, sizeof(best));
+            for (u8 node = 0; node < sJunctions.node_count; node++)
+            {
+                cell = sJunctions.nodes[node].cell;
+                side = sFlowField.side[cell.row][cell.col];
+                if (side == FLOW_FIELD_NO_SIDE)
+                    continue; // PacMan's cell, or out of his reach
+
+                safety = flee_safety(node);
+                if (safety > best[side])
+                {
+                    best[side] = safety;
+                    sFleeTargets[pacman.row][pacman.col][side] = node;
+                }
+            }
+        }
+    }
+}
+
+// Looks up where the ghost should flee to: the safest junction on its side of PacMan, or on any side if
+// the ghost has none (i.e. it's on his cell). Returns false if PacMan can't reach any junction.
+_PRIVATE bool find_flee_target(const PM_Ghost *const ghost, PM_MazeCell *out_target)
+{
+    refresh_flow_field();
+    const u8 *const targets = sFleeTargets[sPacMan.row][sPacMan.col];
+    const u8 side = sFlowField.side[ghost->cell.row][ghost->cell.col];
+
+    u8 node = (side != FLOW_FIELD_NO_SIDE) ? targets[side] : JUNCTION_NIL;
+    for (u8 dir = 0; node == JUNCTION_NIL && dir < 4; dir++)
+        node = targets[dir];
+
+    if (node == JUNCTION_NIL)
+        return false;
+
+    *out_target = sJunctions.nodes[node].cell;
+    return true;
+}
+#endif
+
+#if PM_GHOST_PATHING == PM_PATHING_NEXT_HOP
+// Looks up the first step from a cell towards the goal in the build-time next-hop table of the
+// base maze, in O(1). Returns false if the table is not available (i.e. it would have been too
+// large for the flash), or if it doesn't cover one of the two cells.
+_PRIVATE bool next_hop_lookup(PM_MazeCell from, PM_MazeCell to, PM_MazeCell *out_next)
+{
+#if PACMAN_BASEMAZE_HAS_NEXTHOP
+    const u16 from_index = PACMAN_BaseMazeCellIndex[from.row][from.col];
+    const u16 to_index = PACMAN_BaseMazeCellIndex[to.row][to.col];
+    if (from_index == PM_NEXTHOP_NO_CELL || to_index == PM_NEXTHOP_NO_CELL)
+        return false;
+
+    if (from_index == to_index)
+    {
+        *out_next = from;
+        return true;
+    }
+
+    // 4 entries of 2 bits per byte, each one being the direction as an offset from PM_MOV_UP.
+    const u32 entry = (u32)from_index * PACMAN_BASEMAZE_NEXTHOP_CELLS + to_index;
+    const u8 dir = (PACMAN_BaseMazeNextHop[entry / 4] >> (2 * (entry % 4))) & 0x3;
+    *out_next = cell_step(from, (PM_MovementDir)(PM_MOV_UP + dir));
+    return true;
+#else
+    return false;
+#endif
+}
+#endif
+
+#if PATH_USES_ASTAR
+// Brings the path of the ghost up to date with the goal. The path held by the ghost is a shortest one
+// to the old goal: if the new goal is one step farther and next to it, appending the new goal keeps the
+// path the shortest; if the new goal is the cell before the old one, dropping the last step does.
+_PRIVATE AStarStatus repair_path(PM_Ghost *const ghost, PM_MazeCell goal)
+{
+    PM_GhostPath *const path = &ghost->path;
+    u16 length;
+    const AStarStatus status = find_path_to_goal(ghost->cell, goal, &length);
+    if (status != ASTAR_FOUND)
+        return status;
+
+    if (path->is_valid && !path->is_truncated)
+    {
+        if (length == path->length + 1 && heuristic(path->goal, goal) == 1 &&
+            ghost_path_push_back(path, cell_dir_to(path->goal, goal)))
+        {
+            // Moved one cell farther
+            path->goal = goal;
+            return ASTAR_FOUND;
+        }
+
+        // Going back along the last step from the old goal.
+        const u8 back_dir = path->length ? ghost_path_get(path, path->length - 1) ^ 1 : 0;
+        if (path->length && length == path->length - 1 &&
+            cells_equal(cell_step(path->goal, (PM_MovementDir)(PM_MOV_UP + back_dir)), goal))
+        {
+            // Moved one cell back along the path
+            path->goal = goal;
+            path->length--;
+            return ASTAR_FOUND;
+        }
+    }
+
+    reconstruct_path(path, ghost->cell);
+    path->goal = goal;
+    return ASTAR_FOUND;
+}
+
+// Follows the A* path towards PacMan, or towards the flee target if the ghost is scared. Either way,
+// the path is repaired as soon as the goal moves, so fleeing costs the same as chasing. A truncated
+// path is rebuilt once the ghost has walked all of its steps. While the search of the new path is
+// pending, the ghost keeps following its previous one, which still leads to the previous goal.
+_PRIVATE bool follow_astar_path(PM_Ghost *const ghost, PM_MazeCell *out_next)
+{
+    PM_GhostPath *const path = &ghost->path;
+
+    PM_MazeCell goal = sPacMan;
+    if (ghost->is_scared && !find_flee_target(ghost, &goal))
+        return false;
+
+    if (!path->is_valid || !cells_equal(goal, path->goal) || (!path->length && path->is_truncated))
+    {
+        const AStarStatus status = repair_path(ghost, goal);
+        if (status != ASTAR_PENDING)
+            path->is_valid = (status == ASTAR_FOUND);
+    }
+
+    if (!path->is_valid || !path->length)
+        return false;
+
+    *out_next = ghost_path_pop_front(path);
+    return true;
+}
+#endif
+
+// PUBLIC FUNCTIONS
+
+void PM_PathLoadMaze(const PM_MazeTiles *const tiles)
+{
+    // The junction graph and the flee targets depend on the tiles only, hence they're built once for
+    // them. The search tree is dropped anyway, so that a game doesn't depend on the ones before it.
+    if (tiles != sMazeTiles)
+    {
+        sMazeTiles = tiles;
+        build_junction_graph();
+#if PATH_USES_ASTAR
+        build_flee_targets();
+#endif
+    }
+
+    sPacMan = tiles->pacman_spawn;
+    memset(&sStats, 0, sizeof(sStats));
+    astar_reset();
+    sFlowFieldStale = true;
+}
+
+void PM_PathUpdatePacMan(PM_MazeCell pacman)
+{
+    sPacMan = pacman;
+    sFlowFieldStale = true;
+}
+
+// Picks the next cell of the ghost, with the pathfinding strategy chosen through PM_GHOST_PATHING.
+bool PM_PathGhostNextCell(PM_Ghost *const ghost, PM_MazeCell *out_next)
+{
+#if PM_GHOST_PATHING == PM_PATHING_FLOW_FIELD
+    return flow_field_step(ghost->cell, ghost->is_scared, out_next);
+#else
+#if PM_GHOST_PATHING == PM_PATHING_NEXT_HOP
+    // The next step comes straight from the next-hop table, towards PacMan or the flee target.
+    // The live A* search is the fallback when the table is not available.
+    PM_MazeCell goal = sPacMan;
+    if ((!ghost->is_scared || find_flee_target(ghost, &goal)) && next_hop_lookup(ghost->cell, goal, out_next))
+    {
+        ghost->path.is_valid = false; // The A* path, if any, is stale now.
+        return true;
+    }
+#endif
+    return follow_astar_path(ghost, out_next);
+#endif
+}
+
+PM_PathStats PM_PathGetStats(void)
+{
+    return sStats;
+}
@@ -0,0 +1,28 @@
+#ifndef __PACMAN_PATH_H
+#define __PACMAN_PATH_H
+
+#include "pacman_types.h"
+
+/// @brief Work done by the ghost pathfinding since the maze was loaded.
+typedef struct
+{
+    u32 searches;   // Calls that ran the A* search, resumed ones included
+    u32 restarts;   // Search trees rooted anew, i.e. the ones that couldn't be reused
+    u32 expansions; // Junctions expanded, over all the searches
+} PM_PathStats;
+
+/// @brief Gets the pathfinding ready for a new game on the tiles given. The structures depending on
+///        the tiles are built on the first game only: the tiles are referenced, not copied, and
+///        must not change while they're loaded.
+void PM_PathLoadMaze(const PM_MazeTiles *const tiles);
+
+/// @brief Tells the pathfinding where PacMan is. To be called each time he changes cell.
+void PM_PathUpdatePacMan(PM_MazeCell pacman);
+
+/// @brief Picks the next cell of the ghost, towards PacMan or away from him if scared.
+/// @return false if the ghost should stay still, e.g. because PacMan is out of reach.
+bool PM_PathGhostNextCell(PM_Ghost *const ghost, PM_MazeCell *out_next);
+
+PM_PathStats PM_PathGetStats(void);
+
+#endif
@@ -0,0 +1,131 @@
+#include "pacman_replay.h"
+
+// PRIVATE DEFINES
+
+#define ENTRY_DIR_MASK 0x7
+#define ENTRY_PAUSE_BIT 0x8
+#define ENTRY_IDLE_SHIFT 4
+#define ENTRY_IDLE_MAX 15 // Idle ticks held by the entry byte, from here on a varint follows
+#define ENTRY_MAX_SIZE 6  // Entry byte plus a varint of up to 32 bits
+
+// ENCODING
+
+// Appends the input to the replay, along with the idle ticks preceding it.
+_PRIVATE bool write_entry(PM_Replay *const rec, PM_Input input)
+{
+    if (rec->length + ENTRY_MAX_SIZE > PM_REPLAY_CAPACITY)
+        return false;
+
+    const u32 idle = rec->ticks - rec->input_end;
+    rec->data[rec->length++] = (input.dir & ENTRY_DIR_MASK) | (input.toggle_pause ? ENTRY_PAUSE_BIT : 0) |
+                               ((idle < ENTRY_IDLE_MAX ? idle : ENTRY_IDLE_MAX) << ENTRY_IDLE_SHIFT);
+
+    if (idle >= ENTRY_IDLE_MAX)
+    {
+        u32 rest = idle - ENTRY_IDLE_MAX;
+        do
+        {
+            rec->data[rec->length++] = (rest & 0x7F) | (rest > 0x7F ? 0x80 : 0);
+            rest >>= 7;
+        } while (rest);
+    }
+
+    return true;
+}
+
+// Decodes the next entry of the replay, if any, into the next input of the player.
+_PRIVATE void read_entry(PM_ReplayPlayer *const player)
+{
+    const PM_Replay *const replay = player->replay;
+    if (player->pos >= replay->length)
+    {
+        player->next_tick = replay->ticks;
+        return;
+    }
+
+    const u8 entry = replay->data[player->pos++];
+    u32 idle = entry >> ENTRY_IDLE_SHIFT;
+    if (idle == ENTRY_IDLE_MAX)
+    {
+        u8 byte, shift = 0;
+        do
+        {
+            byte = replay->data[player->pos++];
+            idle += (u32)(byte & 0x7F) << shift;
+            shift += 7;
+        } while (byte & 0x80);
+    }
+
+    player->next_tick = player->tick + idle;
+    player->next_input = (PM_Input){
+        .dir = (PM_MovementDir)(entry & ENTRY_DIR_MASK),
+        .toggle_pause = entry & ENTRY_PAUSE_BIT,
+    };
+}
+
+// PUBLIC FUNCTIONS
+
+void PM_ReplayRecordNewGame(PM_Replay *const rec, PM_Speed speed, u32 seed)
+{
+    rec->seed = seed;
+    rec->speed = speed;
+    rec->ticks = 0;
+    rec->input_end = 0;
+    rec->length = 0;
+    rec->is_truncated = false;
+
+    PM_CoreNewGame(speed, seed);
+}
+
+PM_Events PM_ReplayRecordStep(PM_Replay *const rec, PM_Input input)
+{
+    const PM_Game *const game = PM_CoreGetGame();
+    if (!game->is_over && !rec->is_truncated)
+    {
+        // Dropping the inputs that change nothing, e.g. the direction PacMan already has,
+        // which the joystick repeats as long as it's held.
+        if (PM_CoreIsInputIdle(input))
+            input = (PM_Input){.dir = PM_MOV_NONE, .toggle_pause = false};
+        else if (write_entry(rec, input))
+            rec->input_end = rec->ticks + 1;
+        else
+            rec->is_truncated = true;
+
+        // Once truncated, the replay ends right before the input that didn't fit.
+        if (!rec->is_truncated)
+            rec->ticks++;
+    }
+
+    return PM_CoreStep(input);
+}
+
+void PM_ReplayPlayNewGame(PM_ReplayPlayer *const player, const PM_Replay *const replay)
+{
+    player->replay = replay;
+    player->pos = 0;
+    player->tick = 0;
+    read_entry(player);
+
+    PM_CoreNewGame(replay->speed, replay->seed);
+}
+
+bool PM_ReplayPlayStep(PM_ReplayPlayer *const player, PM_Events *out_events)
+{
+    if (player->tick >= player->replay->ticks)
+        return false;
+
+    // The idle ticks of the next entry are counted from the tick after this one.
+    PM_Input input = {.dir = PM_MOV_NONE, .toggle_pause = false};
+    const bool has_input = player->tick++ == player->next_tick;
+    if (has_input)
+    {
+        input = player->next_input;
+        read_entry(player);
+    }
+
+    const PM_Events events = PM_CoreStep(input);
+    if (out_events)
+        *out_events = events;
+
+    return true;
+}
@@ -0,0 +1,56 @@
+#ifndef __PACMAN_REPLAY_H
+#define __PACMAN_REPLAY_H
+
+#include "pacman_core.h"
+
+/// @brief Bytes of input a replay can hold. A minute of play takes about 2 bytes
+///        per direction change or pause toggle, i.e. a couple hundred bytes.
+#define PM_REPLAY_CAPACITY 512
+
+/// @brief Recordings of the last games kept on the board.
+#define PM_REPLAY_HISTORY 4
+
+/// @brief Recording of a game: the seed and the speed it started with, plus the inputs
+///        that changed something, each after the run of idle ticks preceding it.
+/// @note The stream is a sequence of entries, each made of a byte and an optional varint:
+///       - bits 0-2: direction given, as a PM_MovementDir (PM_MOV_NONE if none);
+///       - bit 3: pause toggled;
+///       - bits 4-7: idle ticks before the input. If 15, the count minus 15 follows
+///         as a little-endian base-128 varint.
+///       The idle ticks after the last input are given by `ticks`.
+typedef struct
+{
+    u32 seed;
+    PM_Speed speed;
+    u32 ticks;         // Ticks recorded, the one ending the game included
+    u32 input_end;     // Tick after the last input recorded, where the current idle run starts
+    u16 length;        // Bytes of `data` in use
+    bool is_truncated; // If the capacity ran out, the replay holds the ticks recorded before
+    u8 data[PM_REPLAY_CAPACITY];
+} PM_Replay;
+
+/// @brief Playback state of a replay.
+typedef struct
+{
+    const PM_Replay *replay;
+    u16 pos;            // Entry after the next one, in replay->data
+    u32 tick;           // Ticks played so far
+    u32 next_tick;      // Tick of the next input, or replay->ticks if none
+    PM_Input next_input;
+} PM_ReplayPlayer;
+
+/// @brief Starts a new game with PM_CoreNewGame, recording it from scratch into the replay.
+void PM_ReplayRecordNewGame(PM_Replay *const rec, PM_Speed speed, u32 seed);
+
+/// @brief Records the input, then advances the game with PM_CoreStep. The inputs
+///        that don't change the game (e.g. the direction PacMan already has) are dropped.
+PM_Events PM_ReplayRecordStep(PM_Replay *const rec, PM_Input input);
+
+/// @brief Starts the game of the replay with PM_CoreNewGame, ready to be played back.
+void PM_ReplayPlayNewGame(PM_ReplayPlayer *const player, const PM_Replay *const replay);
+
+/// @brief Advances the game by a tick with the input recorded for it.
+/// @return false if there are no more ticks to play, and the game was left untouched.
+bool PM_ReplayPlayStep(PM_ReplayPlayer *const player, PM_Events *out_events);
+
+#endif
@@ -0,0 +1,216 @@
+#include "pacman_sprite.h"
+
+// PRIVATE TYPES
+
+typedef struct
+{
+    u16 x0, y0, x1, y1; // Inclusive
+} Area;
+
+// UTILS
+
+_PRIVATE inline Area area_of(LCD_Coordinate pos, const PM_SpriteBitmap *const bitmap)
+{
+    return (Area){pos.x, pos.y, pos.x + bitmap->width - 1, pos.y + bitmap->height - 1};
+}
+
+_PRIVATE inline bool area_has(Area area, u16 x, u16 y)
+{
+    return IS_BETWEEN_EQ(x, area.x0, area.x1) && IS_BETWEEN_EQ(y, area.y0, area.y1);
+}
+
+// Pixels a sprite may change: the ones it covered and the ones it covers now. Where the two overlap, as
+// when the sprite moves by a few pixels, they're merged into one area. Otherwise, e.g. through a portal,
+// they're kept apart, so that the screen between them isn't scanned.
+// Returns the number of areas, 1 or 2.
+_PRIVATE u8 areas_to_draw(const PM_Sprite *const sprite, Area *out_areas)
+{
+    const Area area = area_of(sprite->pos, sprite->bitmap);
+    out_areas[0] = area;
+    if (!sprite->is_drawn)
+        return 1;
+
+    const Area drawn = area_of(sprite->drawn_pos, sprite->drawn_bitmap);
+    if (drawn.x0 > area.x1 || area.x0 > drawn.x1 || drawn.y0 > area.y1 || area.y0 > drawn.y1)
+    {
+        out_areas[1] = drawn;
+        return 2;
+    }
+
+    out_areas[0] = (Area){
+        .x0 = drawn.x0 < area.x0 ? drawn.x0 : area.x0,
+        .y0 = drawn.y0 < area.y0 ? drawn.y0 : area.y0,
+        .x1 = drawn.x1 > area.x1 ? drawn.x1 : area.x1,
+        .y1 = drawn.y1 > area.y1 ? drawn.y1 : area.y1,
+    };
+    return 1;
+}
+
+// Looks for the topmost sprite drawn at the pixel, either as it was drawn or as it's to be drawn.
+_PRIVATE bool sprite_color_at(const PM_Sprite *const sprites, u8 count, u16 x, u16 y, bool drawn, u16 *out_color)
+{
+    const PM_Sprite *sprite;
+    const PM_SpriteBitmap *bitmap;
+    LCD_Coordinate pos;
+    for (u8 i = count; i-- > 0;)
+    {
+        sprite = &sprites[i];
+        if (drawn && !sprite->is_drawn)
+            continue;
+
+        bitmap = drawn ? sprite->drawn_bitmap : sprite->bitmap;
+        pos = drawn ? sprite->drawn_pos : sprite->pos;
+        if (!area_has(area_of(pos, bitmap), x, y) || !(bitmap->opaque[y - pos.y] & (1U << (x - pos.x))))
+            continue;
+
+        *out_color = bitmap->pixels[y - pos.y][x - pos.x];
+        return true;
+    }
+
+    return false;
+}
+
+// PUBLIC FUNCTIONS
+
+bool PM_SpriteLoadImage(PM_SpriteBitmap *const out, const LCD_Image *const image)
+{
+    if (image->width > PM_SPRITE_MAX_SIZE || image->height > PM_SPRITE_MAX_SIZE)
+        return false;
+
+    out->width = image->width;
+    out->height = image->height;
+
+    // The data is a sequence of (count, color) pairs, row after row.
+    const u32 *data = image->pixels;
+    const u16 total = image->width * image->height;
+    u16 count, row, col;
+    u32 color;
+    for (u16 i = 0; i < total; data += 2)
+    {
+        count = data[0];
+        color = data[1];
+        for (; count && i < total; count--, i++)
+        {
+            row = i / image->width;
+            col = i % image->width;
+            if (col == 0)
+                out->opaque[row] = 0;
+
+            if (image->has_alpha && (color >> 24) == 0)
+                continue;
+
+            out->pixels[row][col] = RGB8_TO_RGB565(color);
+            out->opaque[row] |= 1U << col;
+        }
+    }
+
+    return true;
+}
+
+bool PM_SpriteLoadCircle(PM_SpriteBitmap *const out, u16 radius, LCD_Color color)
+{
+    const u16 size = radius * 2 + 1;
+    if (size > PM_SPRITE_MAX_SIZE)
+        return false;
+
+    out->width = size;
+    out->height = size;
+
+    const u16 rgb565 = RGB8_TO_RGB565(color);
+    i16 dx, dy;
+    for (u16 row = 0; row < size; row++)
+    {
+        out->opaque[row] = 0;
+        for (u16 col = 0; col < size; col++)
+        {
+            dx = col - radius;
+            dy = row - radius;
+            if (dx * dx + dy * dy > radius * radius)
+                continue;
+
+            out->pixels[row][col] = rgb565;
+            out->opaque[row] |= 1U << col;
+        }
+    }
+
+    return true;
+}
+
+void PM_SpriteInit(PM_Sprite *const sprite, const PM_SpriteBitmap *const frames, u8 frame_count)
+{
+    *sprite = (PM_Sprite){.frames = frames, .frame_count = frame_count, .frame = 0, .bitmap = &frames[0]};
+}
+
+void PM_SpriteSetFrame(PM_Sprite *const sprite, u8 frame)
+{
+    if (frame >= sprite->frame_count)
+        return;
+
+    sprite->frame = frame;
+    sprite->bitmap = &sprite->frames[frame];
+}
+
+bool PM_SpritesCover(const PM_Sprite *const sprites, u8 count, LCD_Coordinate point)
+{
+    u16 color;
+    return sprite_color_at(sprites, count, point.x, point.y, true, &color);
+}
+
+u32 PM_SpritesDraw(PM_Sprite *const sprites, u8 count, PM_SpriteBackground background)
+{
+    if (count > PM_SPRITE_MAX_COUNT)
+        count = PM_SPRITE_MAX_COUNT;
+
+    Area areas[PM_SPRITE_MAX_COUNT * 2];
+    u8 area_count = 0;
+    for (u8 i = 0; i < count; i++)
+        area_count += areas_to_draw(&sprites[i], &areas[area_count]);
+
+    u32 written = 0;
+    bool was_sprite, is_sprite, done;
+    u16 was, is;
+    for (u8 i = 0; i < area_count; i++)
+    {
+        for (u16 y = areas[i].y0; y <= areas[i].y1; y++)
+        {
+            for (u16 x = areas[i].x0; x <= areas[i].x1; x++)
+            {
+                // Where the areas overlap, the pixel was done along with the ones of an area before.
+                done = false;
+                for (u8 j = 0; j < i && !done; j++)
+                    done = area_has(areas[j], x, y);
+
+                if (done)
+                    continue;
+
+                was_sprite = sprite_color_at(sprites, count, x, y, true, &was);
+                is_sprite = sprite_color_at(sprites, count, x, y, false, &is);
+                if (!was_sprite && !is_sprite)
+                    continue;
+
+                // The background is only looked up when a sprite leaves or enters the pixel.
+                if (!was_sprite || !is_sprite)
+                {
+                    const u16 under = background((LCD_Coordinate){x, y});
+                    was = was_sprite ? was : under;
+                    is = is_sprite ? is : under;
+                }
+
+                if (was == is)
+                    continue;
+
+                LCD_SetPointColor(is, (LCD_Coordinate){x, y});
+                written++;
+            }
+        }
+    }
+
+    for (u8 i = 0; i < count; i++)
+    {
+        sprites[i].drawn_bitmap = sprites[i].bitmap;
+        sprites[i].drawn_pos = sprites[i].pos;
+        sprites[i].is_drawn = true;
+    }
+
+    return written;
+}
@@ -0,0 +1,64 @@
+#ifndef __PACMAN_SPRITE_H
+#define __PACMAN_SPRITE_H
+
+#include "glcd.h"
+#include "pacman_types.h"
+
+/// @brief Largest side of a sprite bitmap, in pixels.
+#define PM_SPRITE_MAX_SIZE 16
+
+/// @brief Sprites PM_SpritesDraw can bring up to date at once.
+#define PM_SPRITE_MAX_COUNT 8
+
+/// @brief Pixels of a sprite, in RGB565. Bit c of opaque[r] tells whether the pixel at row r
+///        and column c is drawn: where it's not, the background shows through.
+typedef struct
+{
+    u16 pixels[PM_SPRITE_MAX_SIZE][PM_SPRITE_MAX_SIZE];
+    u16 opaque[PM_SPRITE_MAX_SIZE];
+    u8 width, height;
+} PM_SpriteBitmap;
+
+/// @brief A sprite drawn straight to the LCD, outside of the render list of the GLCD, so that
+///        it can be moved by a pixel at a time writing only the pixels that change. It shows
+///        one of its frames, e.g. the looks of a ghost, all of them loaded beforehand.
+typedef struct
+{
+    const PM_SpriteBitmap *frames;
+    u8 frame_count, frame;
+    const PM_SpriteBitmap *bitmap, *drawn_bitmap; // Frame to draw, and the one drawn
+    LCD_Coordinate pos, drawn_pos; // Top-left corners to draw at, and the one it's drawn at
+    bool is_drawn;
+} PM_Sprite;
+
+/// @brief Returns the RGB565 color of what's under the sprites at the given pixel.
+typedef u16 (*PM_SpriteBackground)(LCD_Coordinate point);
+
+/// @brief Converts an image, which may be RLE-compressed by img2c.py, into a bitmap.
+/// @return false if the image is larger than PM_SPRITE_MAX_SIZE.
+bool PM_SpriteLoadImage(PM_SpriteBitmap *const out, const LCD_Image *const image);
+
+/// @brief Draws a filled circle into a bitmap, the same size as its bounding box.
+/// @param color The RGB888 color of the circle, as the one of an LCD_Circle.
+/// @return false if the circle is larger than PM_SPRITE_MAX_SIZE.
+bool PM_SpriteLoadCircle(PM_SpriteBitmap *const out, u16 radius, LCD_Color color);
+
+/// @brief Sets up a sprite showing the first of its frames, to be drawn by the next PM_SpritesDraw.
+/// @param frames The bitmaps of the frames, which must stay loaded while the sprite is drawn.
+void PM_SpriteInit(PM_Sprite *const sprite, const PM_SpriteBitmap *const frames, u8 frame_count);
+
+/// @brief Switches the sprite to another of its frames, in place. Nothing is allocated nor drawn:
+///        the next PM_SpritesDraw rewrites the pixels that differ between the frames, if any.
+void PM_SpriteSetFrame(PM_Sprite *const sprite, u8 frame);
+
+/// @brief Whether a pixel of one of the sprites is drawn over the point, hiding what's under it.
+bool PM_SpritesCover(const PM_Sprite *const sprites, u8 count, LCD_Coordinate point);
+
+/// @brief Brings the sprites on the screen up to date with their bitmaps and positions. Only the
+///        pixels whose color changes are written: as a sprite moves by a few pixels, the strips
+///        it leaves and enters.
+/// @param sprites The sprites, from the bottom one to the top one.
+/// @return The number of pixels written.
+u32 PM_SpritesDraw(PM_Sprite *const sprites, u8 count, PM_SpriteBackground background);
+
+#endif
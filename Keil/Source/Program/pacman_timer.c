@@ -0,0 +1,129 @@
+#include "pacman_timer.h"
+
+// UTILS
+
+#define SLOT_MASK (PM_TIMER_SLOTS - 1)
+#define LEVEL_SHIFT(level) ((level) * PM_TIMER_SLOT_BITS)
+
+// Head of the list a timer is in: a slot of the wheel, or the list of the timers due.
+_PRIVATE inline u8 *list_of(PM_TimerWheel *const wheel, const PM_Timer *const timer)
+{
+    return (timer->level == PM_TIMER_LEVELS) ? &wheel->due : &wheel->slots[timer->level][timer->slot];
+}
+
+// The lists are kept sorted by ID, so that the timers due on a tick fire in the order of their IDs.
+_PRIVATE void list_insert(PM_TimerWheel *const wheel, u8 *head, u8 id)
+{
+    while (*head != PM_TIMER_NONE && *head < id)
+        head = &wheel->timers[*head].next;
+
+    wheel->timers[id].next = *head;
+    *head = id;
+}
+
+_PRIVATE void list_remove(PM_TimerWheel *const wheel, u8 *head, u8 id)
+{
+    while (*head != id)
+        head = &wheel->timers[*head].next;
+
+    *head = wheel->timers[id].next;
+}
+
+// Puts a timer in the lowest level whose turn spans the ticks till it fires. The slot it's put in
+// is the first one of the level to be reached before, or on, the tick it fires on.
+_PRIVATE void place(PM_TimerWheel *const wheel, u8 id)
+{
+    PM_Timer *const timer = &wheel->timers[id];
+    const u32 ticks = timer->expires - wheel->now;
+
+    u8 level = 0;
+    while (level < PM_TIMER_LEVELS - 1 && ticks >= (1UL << LEVEL_SHIFT(level + 1)))
+        level++;
+
+    // Beyond the span of the wheel, the timer waits in the farthest slot, and is placed again from there.
+    u32 at = timer->expires;
+    if (ticks >= (1UL << LEVEL_SHIFT(PM_TIMER_LEVELS)))
+        at = wheel->now + ((u32)SLOT_MASK << LEVEL_SHIFT(level));
+
+    timer->level = level;
+    timer->slot = (at >> LEVEL_SHIFT(level)) & SLOT_MASK;
+    list_insert(wheel, &wheel->slots[level][timer->slot], id);
+}
+
+// PUBLIC FUNCTIONS
+
+void PM_TimerInit(PM_TimerWheel *const wheel)
+{
+    wheel->now = 0;
+    wheel->due = PM_TIMER_NONE;
+    for (u8 level = 0; level < PM_TIMER_LEVELS; level++)
+        for (u8 slot = 0; slot < PM_TIMER_SLOTS; slot++)
+            wheel->slots[level][slot] = PM_TIMER_NONE;
+
+    for (u8 id = 0; id < PM_TIMER_MAX_COUNT; id++)
+        wheel->timers[id] = (PM_Timer){.next = PM_TIMER_NONE, .is_pending = false};
+}
+
+void PM_TimerPost(PM_TimerWheel *const wheel, u8 id, u32 ticks)
+{
+    if (id >= PM_TIMER_MAX_COUNT)
+        return;
+
+    PM_TimerCancel(wheel, id);
+
+    // A timer can't fire on the tick it's posted on, the timers of the tick may be already firing.
+    PM_Timer *const timer = &wheel->timers[id];
+    timer->expires = wheel->now + (ticks ? ticks : 1);
+    timer->is_pending = true;
+    place(wheel, id);
+}
+
+void PM_TimerCancel(PM_TimerWheel *const wheel, u8 id)
+{
+    if (id >= PM_TIMER_MAX_COUNT || !wheel->timers[id].is_pending)
+        return;
+
+    list_remove(wheel, list_of(wheel, &wheel->timers[id]), id);
+    wheel->timers[id].is_pending = false;
+}
+
+void PM_TimerAdvance(PM_TimerWheel *const wheel)
+{
+    wheel->now++;
+
+    // Once a turn of a level is over, the next slot of the level above is spread over the levels below.
+    u8 id, next, *slot;
+    for (u8 level = PM_TIMER_LEVELS - 1; level > 0; level--)
+    {
+        if (wheel->now & ((1UL << LEVEL_SHIFT(level)) - 1))
+            continue;
+
+        slot = &wheel->slots[level][(wheel->now >> LEVEL_SHIFT(level)) & SLOT_MASK];
+        for (id = *slot, *slot = PM_TIMER_NONE; id != PM_TIMER_NONE; id = next)
+        {
+            next = wheel->timers[id].next;
+            place(wheel, id);
+        }
+    }
+
+    // The timers in the slot of level 0 all fire on this tick.
+    slot = &wheel->slots[0][wheel->now & SLOT_MASK];
+    for (id = *slot, *slot = PM_TIMER_NONE; id != PM_TIMER_NONE; id = next)
+    {
+        next = wheel->timers[id].next;
+        wheel->timers[id].level = PM_TIMER_LEVELS;
+        list_insert(wheel, &wheel->due, id);
+    }
+}
+
+bool PM_TimerNextDue(PM_TimerWheel *const wheel, u8 *const out_id)
+{
+    if (wheel->due == PM_TIMER_NONE)
+        return false;
+
+    const u8 id = wheel->due;
+    wheel->due = wheel->timers[id].next;
+    wheel->timers[id].is_pending = false;
+    *out_id = id;
+    return true;
+}
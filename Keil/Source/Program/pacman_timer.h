@@ -0,0 +1,55 @@
+#ifndef __PACMAN_TIMER_H
+#define __PACMAN_TIMER_H
+
+#include "pacman_types.h"
+
+// Slots of each level of the wheel. A slot of level 0 lasts a tick, one of level 1 lasts a whole
+// turn of level 0, and so on: with 2 levels of 64 slots, timers up to 4096 ticks away are placed
+// exactly. Farther ones are placed again as their time gets closer.
+#define PM_TIMER_SLOT_BITS 6
+#define PM_TIMER_SLOTS (1 << PM_TIMER_SLOT_BITS)
+#define PM_TIMER_LEVELS 2
+
+/// @brief Timers a wheel can hold, each one with its own ID.
+#define PM_TIMER_MAX_COUNT 16
+
+#define PM_TIMER_NONE 0xFF
+
+typedef struct
+{
+    u32 expires; // Tick it fires on
+    u8 next;     // Next timer of the list it's in, or PM_TIMER_NONE
+    u8 level;    // Level of the wheel it's in, PM_TIMER_LEVELS once it's due
+    u8 slot;     // Slot of that level
+    bool is_pending;
+} PM_Timer;
+
+/// @brief Hierarchical timer wheel, keyed on ticks. Each timer is posted once and fires exactly on
+///        the tick it was posted for, and a tick with nothing to fire costs the same however many
+///        timers are pending. The timers are identified by the caller's IDs, from 0 to
+///        PM_TIMER_MAX_COUNT - 1: those firing on the same tick come out in the order of their IDs.
+typedef struct
+{
+    u32 now;
+    u8 slots[PM_TIMER_LEVELS][PM_TIMER_SLOTS]; // First timer of each slot, or PM_TIMER_NONE
+    u8 due;                                    // First timer due on the current tick
+    PM_Timer timers[PM_TIMER_MAX_COUNT];
+} PM_TimerWheel;
+
+/// @brief Empties the wheel, and sets its time to tick 0.
+void PM_TimerInit(PM_TimerWheel *const wheel);
+
+/// @brief Posts a timer to fire in the given number of ticks, from 1 on. If it was pending, it's moved.
+void PM_TimerPost(PM_TimerWheel *const wheel, u8 id, u32 ticks);
+
+/// @brief Cancels a timer, if it's pending.
+void PM_TimerCancel(PM_TimerWheel *const wheel, u8 id);
+
+/// @brief Advances the time of the wheel by a tick, making the timers of that tick due.
+void PM_TimerAdvance(PM_TimerWheel *const wheel);
+
+/// @brief Takes the next timer due on the current tick, if any. A timer may be posted again as it fires.
+/// @return false once no timer is left to fire on the current tick.
+bool PM_TimerNextDue(PM_TimerWheel *const wheel, u8 *const out_id);
+
+#endif
@@ -1,8 +1,6 @@
 #ifndef __PACMAN_TYPES_H
 #define __PACMAN_TYPES_H
 
-#include "cl_list.h"
-#include "glcd_types.h"
 #include "types.h"
 
 #include <stdbool.h>
@@ -12,6 +10,10 @@
 #define PM_MAZE_SCALED_WIDTH 23
 #define PM_MAZE_SCALED_HEIGHT 25
 #define PM_MAZE_CELL_SIZE 10
+#define PM_MAZE_CELL_COUNT (PM_MAZE_SCALED_WIDTH * PM_MAZE_SCALED_HEIGHT)
+
+// Marks the cells not covered by the build-time next-hop table (see maze2nexthop.py).
+#define PM_NEXTHOP_NO_CELL 0xFFFF
 
 #define PM_MAZE_PIXEL_WIDTH (PM_MAZE_SCALED_WIDTH * PM_MAZE_CELL_SIZE)
 #define PM_MAZE_PIXEL_HEIGHT (PM_MAZE_SCALED_HEIGHT * PM_MAZE_CELL_SIZE)
@@ -33,7 +35,65 @@
 
 #define MAX_LIVES 5
 
+#define PM_GHOST_COUNT 1
 #define PM_GHOST_SCARED_DURATION 10
+#define PM_GHOST_POINTS 100
+
+// Period of the tick of the game, fine enough for the speeds to be paced smoothly.
+#define PM_TICK_MS 20
+#define PM_TICKS_PER_SEC (1000 / PM_TICK_MS)
+
+// The RIT also drives the input of BigLib, which has no setting for its rates: the joystick is polled on
+// every tick, and a button calls back once it's been seen down on two ticks in a row, i.e. 1 to 2 ticks
+// after the press. A press sooner than PM_BUTTON_HOLDOFF_MS after the last one taken is a bounce of it,
+// and is dropped, whatever the tick.
+#define PM_BUTTON_HOLDOFF_MS 100
+#define PM_BUTTON_HOLDOFF_TICKS ((PM_BUTTON_HOLDOFF_MS + PM_TICK_MS - 1) / PM_TICK_MS)
+
+// Speeds are in cells per second, as fixed-point numbers with PM_SPEED_FRAC_BITS fractional bits.
+// On each tick an entity adds its speed to an accumulator, and moves by a cell once it holds a
+// PM_SPEED_STEP, i.e. a cell per second times a second. No speed may exceed PM_SPEED_STEP.
+#define PM_SPEED_FRAC_BITS 8
+#define PM_CELLS_PER_SEC(cells) ((u16)((cells) * (1 << PM_SPEED_FRAC_BITS) + 0.5))
+#define PM_SPEED_STEP PM_CELLS_PER_SEC(PM_TICKS_PER_SEC)
+
+// Ghost pathfinding strategies, to be chosen through PM_GHOST_PATHING.
+#define PM_PATHING_NEXT_HOP 0   // Build-time all-pairs next-hop table, A* where it's not available
+#define PM_PATHING_FLOW_FIELD 1 // Shared BFS distance map from PacMan, for chasing and fleeing
+#define PM_PATHING_ASTAR 2      // Incremental A* search, for chasing and fleeing
+
+#ifndef PM_GHOST_PATHING
+#define PM_GHOST_PATHING PM_PATHING_NEXT_HOP
+#endif
+
+// Junctions the A* search may expand on each move of a ghost, which bounds the time it takes inside a
+// tick. A search needing more is resumed on the next move, while the ghost follows its old path.
+#ifndef PM_ASTAR_EXPANSIONS_PER_TICK
+#define PM_ASTAR_EXPANSIONS_PER_TICK 16
+#endif
+
+// Pixels PacMan and the ghost are drawn moving by, on their way from a cell to the next one. The
+// smaller, the smoother: each move rewrites the pixels of the sprite that change, and the GLCD sets the
+// cursor again for each one of them. Per cell crossed, a whole cell costs 98 pixels for PacMan and 120
+// for a ghost, within the about 130 the render list moved them with. 5 px costs 148 and 190, 2 px 160
+// and 346, over that: the motion within a cell is off by default, and a smaller step turns it on.
+#ifndef PM_SPRITE_STEP_PX
+#define PM_SPRITE_STEP_PX PM_MAZE_CELL_SIZE
+#endif
+
+// Ticks a frame of the game loop may simulate to catch up after an overrun. The ticks elapsed past
+// that are dropped, i.e. the game slows down instead of running a burst of frames on end.
+#ifndef PM_MAX_TICKS_PER_FRAME
+#define PM_MAX_TICKS_PER_FRAME 8
+#endif
+
+// Storage of the state of the core and of the pathfinding. Defining PM_HOST_BUILD makes it per
+// thread, so that a host can simulate games in parallel. On the board it's plain static storage.
+#ifdef PM_HOST_BUILD
+#define _PM_GAME_STATE _Thread_local
+#else
+#define _PM_GAME_STATE
+#endif
 
 typedef enum
 {
@@ -52,12 +112,42 @@ typedef struct
     u16 row, col;
 } PM_MazeCell;
 
+/// @brief One bit plane of the maze: a mask for each row, in which bit i stands for column i.
+typedef u32 PM_MazeRows[PM_MAZE_SCALED_HEIGHT];
+
+#define PM_MAZE_BIT(col) (1UL << (col))
+#define PM_MAZE_ROW_MASK (PM_MAZE_BIT(PM_MAZE_SCALED_WIDTH) - 1)
+
+_Static_assert(PM_MAZE_SCALED_WIDTH <= 32, "Each maze row must fit in a u32 mask");
+
+/// @brief Rectangle of cells of the maze, e.g. walls merged at build time by maze2walls.py.
+typedef struct
+{
+    u8 row, col, height, width;
+} PM_MazeRect;
+
+/// @brief Static layer of the maze: the tiles that never change while playing. It's loaded once,
+///        and shared by all the games played on the maze.
+typedef struct
+{
+    PM_MazeRows walls, portals;
+    PM_MazeCell pacman_spawn, ghost_spawn;
+} PM_MazeTiles;
+
+/// @brief Bitboard representation of the maze being played, in layers: the static tiles, and the
+///        pills still to be eaten. PacMan and the ghosts are not stored in it but in the entities
+///        of the game, so that moving them never touches the maze.
+typedef struct
+{
+    const PM_MazeTiles *tiles;
+    PM_MazeRows pills, super_pills; // Collectible layer
+} PM_Maze;
+
 // GAME TYPES
 
 typedef struct
 {
     PM_MazeCell cell;
-    LCD_ObjID id;
 
     /// @brief The second of the game between 5 and 59, at
     ///        which the power pill will spawn. This implements
@@ -65,18 +155,27 @@ typedef struct
     u16 spawn_sec;
 } PM_SuperPill;
 
+// Steps a ghost path can hold. The longest shortest path of the base maze is 42 steps long:
+// longer paths are truncated, and rebuilt once the ghost reaches the last step stored.
+#define PM_GHOST_PATH_CAPACITY 64
+
+/// @brief Path of a ghost, stored as the cell it starts from (i.e. the ghost's one), and a
+///        ring buffer of 2-bit directions, one per step, as offsets from PM_MOV_UP.
 typedef struct
 {
-    CL_List *path;
+    PM_MazeCell start, goal;
+    u8 steps[PM_GHOST_PATH_CAPACITY / 4];
+    u8 head, length;   // Slot of the first step in the ring buffer, and number of steps
+    bool is_truncated; // Whether the path goes on after the last step stored
     bool is_valid;
 } PM_GhostPath;
 
 typedef struct
 {
     PM_MazeCell cell;
-    LCD_ObjID id;
-    bool is_scared;
-    u8 scared_counter;
+    PM_MazeCell prev_cell; // Cell left on the last step, or `cell` if it stood still
+    u16 speed, step_acc;   // See PM_CELLS_PER_SEC
+    bool is_scared; // For PM_GHOST_SCARED_DURATION seconds since the last super pill eaten
     PM_GhostPath path;
 } PM_Ghost;
 
@@ -86,17 +185,6 @@ typedef struct
     u16 game_over_in, pills_eaten;
 } PM_GameStatValues;
 
-typedef struct
-{
-    LCD_ObjID titles, lives[MAX_LIVES];
-    LCD_ObjID score_record_values, game_over_in_value;
-} PM_GameStatIDs;
-
-typedef struct
-{
-    char record[10], score[10], game_over_in[10];
-} PM_GameStatStrings;
-
 typedef enum
 {
     PM_MOV_NONE,
@@ -106,6 +194,7 @@ typedef enum
     PM_MOV_RIGHT,
 } PM_MovementDir;
 
+/// @brief Difficulty level, which sets the speeds of PacMan and of the ghost.
 typedef enum
 {
     PM_SPEED_FAST = 0,
@@ -115,28 +204,54 @@ typedef enum
 
 typedef struct
 {
-    LCD_ObjID id;
-    PM_Speed speed;
     PM_MazeCell cell;
+    PM_MazeCell prev_cell; // Cell left on the last step, or `cell` if he stood still
     PM_MovementDir dir;
+    PM_MovementDir next_dir; // Turn asked for, taken on the first step where it's not blocked
+    u16 speed, step_acc;     // See PM_CELLS_PER_SEC
 } PM_PacMan;
 
+/// @brief State of a game, advanced by the core one tick at a time. The view of the game
+///        (sprites, strings) is not part of it: it's kept by the front end drawing it.
 typedef struct
 {
     // GENERIC
     u16 prev_record;
-    bool playing_now;
-    LCD_Coordinate maze_pos;
+    bool playing_now, is_over;
+    PM_Maze maze;
     // PACMAN
     PM_PacMan pacman;
-    // PILLS & GHOST
-    LCD_ObjID pill_ids[PM_MAZE_SCALED_HEIGHT][PM_MAZE_SCALED_WIDTH];
+    // PILLS & GHOSTS
     PM_SuperPill super_pills[PM_SUP_PILL_COUNT];
-    PM_Ghost ghost;
+    u8 super_pills_to_spawn;
+    PM_Ghost ghosts[PM_GHOST_COUNT];
     // GAME STATS
     PM_GameStatValues stat_values;
-    PM_GameStatIDs stat_obj_ids;
-    PM_GameStatStrings stat_strings;
 } PM_Game;
 
+/// @brief Figures of the game loop, to measure how much of each tick the game takes. The cycle
+///        counts are to be compared with the cycles in a tick, i.e. SystemCoreClock / PM_TICKS_PER_SEC.
+typedef struct
+{
+    u32 frames;        // Frames run, each one simulating one or more ticks
+    u32 ticks;         // Ticks simulated
+    u32 skipped_ticks; // Ticks dropped since they were more than PM_MAX_TICKS_PER_FRAME
+    u32 last_cycles;   // CPU cycles taken by the last frame
+    u32 max_cycles;    // CPU cycles taken by the longest frame
+    u32 sprite_pixels; // Pixels written to the LCD to move PacMan and the ghosts, each with its cursor set
+    u32 maze_cycles;   // CPU cycles taken to draw the maze of the last game started
+} PM_FrameStats;
+
+#define PM_INPUT_LATENCY_BUCKETS 8
+
+/// @brief Latency of the input, in ticks: from the joystick event asking for a direction to the
+///        tick PacMan takes it on, waiting for the game loop and for a cell to turn at included.
+typedef struct
+{
+    u32 turns;       // Directions taken
+    u32 total_ticks; // Latency of all of them, to get the mean
+    u32 max_ticks;   // Latency of the slowest
+    u32 histogram[PM_INPUT_LATENCY_BUCKETS]; // Directions taken after 1, 2, ... ticks, the slower ones in the last
+} PM_InputStats;
+
 #endif
\ No newline at end of file
@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+
+from argparse import ArgumentParser as ArgParser
+from mazeparse import parse_maze, neighbors, bfs, find
+
+#? Direction codes, i.e. the offset from PM_MOV_UP in the PM_MovementDir enum.
+DIRS = {(-1, 0): 0, (1, 0): 1, (0, -1): 2, (0, 1): 3}
+
+#? Computes, for every (from, to) pair of cells in the ghost area, the direction of the first step
+#? along a shortest path. Ties are broken in the Up, Down, Left, Right order, like the A* search.
+def build_table(maze, cells):
+    n = len(cells)
+    table = [0] * (n * n)
+    for to_idx, to in enumerate(cells):
+        dist = bfs(maze, to)
+        for from_idx, cell in enumerate(cells):
+            if cell == to:
+                continue
+            step = next(nb for nb in neighbors(maze, *cell) if dist[nb] == dist[cell] - 1)
+            table[from_idx * n + to_idx] = DIRS[(step[0] - cell[0], step[1] - cell[1])]
+    return table
+
+#? Packs 4 entries of 2 bits per byte, the first entry in the 2 least significant bits.
+def pack(table):
+    packed = bytearray((len(table) + 3) // 4)
+    for i, code in enumerate(table):
+        packed[i // 4] |= code << (2 * (i % 4))
+    return packed
+
+#? Dumps the tables to a C header.
+def dump_to(file, maze, cells, packed, name, table_size):
+    h, w = len(maze), len(maze[0])
+    index = {cell: i for i, cell in enumerate(cells)}
+    with open(file, "w") as out:
+        incl_guard = f"__{name.upper()}_NEXTHOP_H"
+        out.write(
+f"""// This table was auto-generated by maze2nexthop.py. Do not edit it manually.
+#ifndef {incl_guard}
+#define {incl_guard}
+
+#include "pacman_types.h"
+
+// Cells reachable by the ghosts: {len(cells)}. Flash needed by the tables: {table_size} bytes.
+#define {name.upper()}_HAS_NEXTHOP {1 if packed else 0}
+""")
+        if packed:
+            out.write(
+f"""#define {name.upper()}_NEXTHOP_CELLS {len(cells)}
+
+// clang-format off
+
+// Dense index of each cell reachable by the ghosts, PM_NEXTHOP_NO_CELL for the others.
+const u16 {name}CellIndex[{h}][{w}] = {{
+""")
+            for r in range(h):
+                values = ", ".join(str(index.get((r, c), "PM_NEXTHOP_NO_CELL")) for c in range(w))
+                out.write(f"    {{{values}}},\n")
+
+            out.write(
+f"""}};
+
+// Entry (from * {len(cells)} + to), 2 bits each: the direction of the first step from -> to,
+// as an offset from PM_MOV_UP. Four entries per byte, starting from the least significant bits.
+const u8 {name}NextHop[{len(packed)}] = {{
+""")
+            for i in range(0, len(packed), 16):
+                out.write("    " + ", ".join(f"0x{b:02X}" for b in packed[i:i + 16]) + ",\n")
+
+            out.write("};\n\n// clang-format on\n")
+
+        out.write("\n#endif")
+
+#? Main program.
+def main():
+    parser = ArgParser(prog='maze2nexthop', description='Precomputes the all-pairs next-hop table of a maze for the ghosts')
+    parser.add_argument('maze_file', type=str, help='C header containing the maze array')
+    parser.add_argument('out_file', type=str, help='Output file in which to write the C-style tables')
+    parser.add_argument('-n', type=str, default='PACMAN_BaseMaze', help='Name of the maze array in the input file')
+    parser.add_argument('-m', type=int, default=32768, help='Maximum table size in bytes, above which only the fallback flag is emitted')
+    args = parser.parse_args()
+
+    maze = parse_maze(args.maze_file, args.n)
+
+    # Only the cells connected to the ghost spawn point matter, and every pair among them has a path.
+    cells = sorted(bfs(maze, find(maze, "PM_GHSR")).keys())
+    table_size = (len(cells) * len(cells) + 3) // 4 + len(maze) * len(maze[0]) * 2
+
+    if table_size <= args.m:
+        print(f"{len(cells)} cells, {table_size} bytes of flash (next-hop table + cell index).")
+        dump_to(args.out_file, maze, cells, pack(build_table(maze, cells)), args.n, table_size)
+    else:
+        print(f"{len(cells)} cells, {table_size} bytes exceed the limit of {args.m}. Ghosts will use live A*.")
+        dump_to(args.out_file, maze, cells, None, args.n, table_size)
+
+if __name__ == "__main__":
+    main()
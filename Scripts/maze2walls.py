@@ -0,0 +1,105 @@
+#!/usr/bin/env python3
+
+from argparse import ArgumentParser as ArgParser
+from mazeparse import parse_maze
+
+#? Cells of the maze holding a wall, as a set of (row, col).
+def wall_cells(maze):
+    return {(r, c) for r, row in enumerate(maze) for c, value in enumerate(row) if value == "PM_WALL"}
+
+#? Largest rectangle made of the given cells only, as (row, col, height, width), through the
+#? histogram of the cells stacked above each one, row by row.
+def largest_rect(cells, h, w):
+    best, heights = None, [0] * w
+    for r in range(h):
+        heights = [heights[c] + 1 if (r, c) in cells else 0 for c in range(w)]
+        stack = []  # Columns of increasing height
+        for c in range(w + 1):
+            height = heights[c] if c < w else 0
+            start = c
+            while stack and heights[stack[-1]] >= height:
+                top = stack.pop()
+                start = stack[-1] + 1 if stack else 0
+                area = heights[top] * (c - start)
+                if heights[top] and (best is None or area > best[2] * best[3]):
+                    best = (r - heights[top] + 1, start, heights[top], c - start)
+            stack.append(c)
+    return best
+
+#? Covers the cells with disjoint rectangles, taking the largest one left each time.
+def split_largest_first(cells, h, w):
+    cells, rects = set(cells), []
+    while cells:
+        rect = largest_rect(cells, h, w)
+        rects.append(rect)
+        cells -= {(rect[0] + i, rect[1] + j) for i in range(rect[2]) for j in range(rect[3])}
+    return rects
+
+#? Covers the cells with disjoint rectangles, scanning them row by row: each run of cells along a
+#? row is merged with the runs just like it in the rows below.
+def split_by_rows(cells, h, w):
+    cells, rects = set(cells), []
+    for r in range(h):
+        for c in range(w):
+            if (r, c) not in cells:
+                continue
+            width = 1
+            while (r, c + width) in cells:
+                width += 1
+            height = 1
+            while all((r + height, c + j) in cells for j in range(width)):
+                height += 1
+            rects.append((r, c, height, width))
+            cells -= {(r + i, c + j) for i in range(height) for j in range(width)}
+    return rects
+
+#? The same, scanning the maze column by column.
+def split_by_cols(cells, h, w):
+    transposed = split_by_rows({(c, r) for r, c in cells}, w, h)
+    return [(c, r, width, height) for r, c, height, width in transposed]
+
+#? Dumps the rectangles to a C header, as a const table next to the maze.
+def dump_to(file, rects, name, wall_count):
+    with open(file, "w") as out:
+        incl_guard = f"__{name.upper()}_WALLS_H"
+        out.write(
+f"""// This table was auto-generated by maze2walls.py. Do not edit it manually.
+#ifndef {incl_guard}
+#define {incl_guard}
+
+#include "pacman_types.h"
+
+// Wall cells: {wall_count}, merged into {len(rects)} rectangles that don't overlap.
+#define {name.upper()}_WALL_RECTS {len(rects)}
+
+// clang-format off
+const PM_MazeRect {name}Walls[{name.upper()}_WALL_RECTS] = {{
+""")
+        for r, c, height, width in sorted(rects):
+            out.write(f"    {{{r}, {c}, {height}, {width}}},\n")
+
+        out.write("};\n// clang-format on\n\n#endif\n")
+
+#? Main program.
+def main():
+    parser = ArgParser(prog='maze2walls', description='Merges the walls of a maze into rectangles, to be drawn with a fill each')
+    parser.add_argument('maze_file', type=str, help='C header containing the maze array')
+    parser.add_argument('out_file', type=str, help='Output file in which to write the C-style table')
+    parser.add_argument('-n', type=str, default='PACMAN_BaseMaze', help='Name of the maze array in the input file')
+    args = parser.parse_args()
+
+    maze = parse_maze(args.maze_file, args.n)
+    h, w = len(maze), len(maze[0])
+    cells = wall_cells(maze)
+
+    # None of the strategies is optimal for every maze, so the one giving the fewest rectangles is kept.
+    rects = min((split(cells, h, w) for split in (split_largest_first, split_by_rows, split_by_cols)), key=len)
+
+    covered = [(r + i, c + j) for r, c, height, width in rects for i in range(height) for j in range(width)]
+    assert len(covered) == len(set(covered)) and set(covered) == cells, "The rectangles must cover the walls exactly"
+
+    print(f"{len(cells)} wall cells merged into {len(rects)} rectangles.")
+    dump_to(args.out_file, rects, args.n, len(cells))
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,53 @@
+#!/usr/bin/env python3
+
+import re
+
+#? Maze objects, in the same order as the PM_MazeObj enum in pacman_types.h
+MAZE_OBJS = ["PM_WALL", "PM_NONE", "PM_PILL", "PM_SUPER_PILL", "PM_PCMN", "PM_LTPL", "PM_RTPL", "PM_GHSR"]
+
+#? Objects that the ghosts can't walk on (same rule as neighbors_finder in pacman.c)
+NOT_WALKABLE = {"PM_WALL", "PM_LTPL", "PM_RTPL"}
+
+#? Parses the rows of the PM_MazeObj array called `name` from a C header.
+def parse_maze(file, name="PACMAN_BaseMaze"):
+    with open(file) as f:
+        src = f.read()
+
+    match = re.search(name + r"\s*\[[^\]]*\]\s*\[[^\]]*\]\s*=\s*\{(.*?)\};", src, re.S)
+    if not match:
+        raise ValueError(f"Maze array '{name}' not found in {file}")
+
+    rows = [re.findall(r"PM_\w+", row) for row in re.findall(r"\{([^{}]*)\}", match.group(1))]
+    if not rows or any(len(row) != len(rows[0]) for row in rows):
+        raise ValueError(f"Maze array '{name}' is not rectangular")
+
+    return rows
+
+#? Returns the 4-neighbors of a walkable cell, in the order Up, Down, Left, Right.
+def neighbors(maze, row, col):
+    for dr, dc in ((-1, 0), (1, 0), (0, -1), (0, 1)):
+        r, c = row + dr, col + dc
+        if 0 <= r < len(maze) and 0 <= c < len(maze[0]) and maze[r][c] not in NOT_WALKABLE:
+            yield r, c
+
+#? Breadth-first distances from a cell to every reachable cell.
+def bfs(maze, start):
+    dist = {start: 0}
+    frontier = [start]
+    while frontier:
+        next_frontier = []
+        for cell in frontier:
+            for n in neighbors(maze, *cell):
+                if n not in dist:
+                    dist[n] = dist[cell] + 1
+                    next_frontier.append(n)
+        frontier = next_frontier
+    return dist
+
+#? Finds the first cell holding the given object.
+def find(maze, obj):
+    for r, row in enumerate(maze):
+        for c, value in enumerate(row):
+            if value == obj:
+                return r, c
+    raise ValueError(f"{obj} not found in maze")
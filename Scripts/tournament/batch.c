@@ -0,0 +1,288 @@
+/*
+ * Lockstep simulator: steps BATCH_LANES games at once, one per lane of GCC's vector extensions,
+ * which compile to SSE/AVX on x86. Everything a game owns is stored structure-of-arrays: a bit
+ * plane row, a position or a counter of all the games fits in a single vector.
+ *
+ * It only plays ghost-free games: the rules are the ones of pacman_core.c for PacMan, the pills and
+ * the timer, followed step by step, and the scalar code they mirror is named in the comments. There
+ * are no ghosts, hence no collisions and no lives, and a game only ends won or with the time up: the
+ * games are not the ones the core plays, and are compared with them in throughput only. The games
+ * start together at the same speed and are never paused, so the periods of the jobs and the timers
+ * of the core elapse in lockstep and are shared by the batch. The step accumulator of PacMan is
+ * not, since he sets off early when starting from still.
+ */
+
+#include "tournament.h"
+
+#include <string.h>
+
+// PRIVATE TYPES
+
+typedef u32 Vec __attribute__((vector_size(BATCH_LANES * sizeof(u32))));
+
+typedef struct
+{
+    // Bit planes of the mazes: row r of game l is in lane l of pills[r].
+    Vec pills[PM_MAZE_SCALED_HEIGHT], super_pills[PM_MAZE_SCALED_HEIGHT];
+    Vec super_pill_row[PM_SUP_PILL_COUNT], super_pill_col[PM_SUP_PILL_COUNT], super_pill_sec[PM_SUP_PILL_COUNT];
+    Vec super_pills_to_spawn;
+
+    Vec row, col, dir, next_dir, step_acc; // PacMan
+    Vec score, pills_eaten, ticks;
+    Vec rng;           // State of the random bot
+    Vec live, victory; // Lane masks, all ones or zero
+
+    u16 pacman_speed;
+    u8 game_over_elapsed;
+    u16 game_over_in;
+} Batch;
+
+// Walls around the PacMan of each game, read before he moves.
+typedef struct
+{
+    Vec bit;                   // Bit of his column
+    Vec up, at, down, portals; // Wall rows above, at and below him, and portal row at him
+} Surroundings;
+
+// STATE VARIABLES
+
+// The walls and the portals are the same for every game, hence they're scalars.
+_PRIVATE _Thread_local PM_MazeRows sWalls, sPortals;
+
+// UTILS
+
+#define SPLAT(x) ((Vec){0} + (u32)(x))
+#define MASK(cond) ((Vec)(cond)) // Comparisons give all ones or zero per lane
+
+_PRIVATE inline Vec select(Vec mask, Vec a, Vec b)
+{
+    return (mask & a) | (~mask & b);
+}
+
+_PRIVATE inline bool any(Vec mask)
+{
+    for (u8 i = 0; i < BATCH_LANES; i++)
+        if (mask[i])
+            return true;
+
+    return false;
+}
+
+_PRIVATE inline Vec xorshift(Vec x)
+{
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return x;
+}
+
+// Each game has its own row, so the wall rows are picked by comparing it against every row.
+_PRIVATE Surroundings surroundings(const Batch *const b)
+{
+    Surroundings s = {.bit = SPLAT(1) << b->col};
+    Vec m;
+    for (u8 r = 0; r < PM_MAZE_SCALED_HEIGHT; r++)
+    {
+        m = MASK(b->row == r);
+        s.at |= m & sWalls[r];
+        s.portals |= m & sPortals[r];
+        if (r > 0)
+            s.up |= m & sWalls[r - 1];
+        if (r < PM_MAZE_SCALED_HEIGHT - 1)
+            s.down |= m & sWalls[r + 1];
+    }
+
+    return s;
+}
+
+// pacman_is_blocked, for each game.
+_PRIVATE Vec is_blocked(const Batch *const b, const Surroundings *const s, Vec dir)
+{
+    const Vec up = MASK(b->row == 0) | MASK((s->up & s->bit) != 0);
+    const Vec down = MASK(b->row == PM_MAZE_SCALED_HEIGHT - 1) | MASK((s->down & s->bit) != 0);
+    const Vec left = MASK(b->col == 0) | MASK((s->at & (s->bit >> 1)) != 0);
+    const Vec right = MASK(b->col == PM_MAZE_SCALED_WIDTH - 1) | MASK((s->at & (s->bit << 1)) != 0);
+
+    return (MASK(dir == PM_MOV_UP) & up) | (MASK(dir == PM_MOV_DOWN) & down) | (MASK(dir == PM_MOV_LEFT) & left) |
+           (MASK(dir == PM_MOV_RIGHT) & right) | MASK(dir == PM_MOV_NONE);
+}
+
+// RULES
+
+// random_bot of tournament.c, drawing from the generator of a game only when the scalar one does.
+_PRIVATE Vec random_bot(Batch *const b, const Surroundings *const s)
+{
+    const Vec has_dir = b->live & MASK(b->dir != PM_MOV_NONE);
+    b->rng = select(has_dir, xorshift(b->rng), b->rng);
+
+    const Vec choose = b->live & ~(has_dir & MASK((b->rng & 7) != 0));
+    b->rng = select(choose, xorshift(b->rng), b->rng);
+
+    const Vec dir = PM_MOV_UP + (b->rng & 3);
+    return choose & ~is_blocked(b, s, dir) & dir;
+}
+
+// PM_CoreStep: the direction is queued as a turn, and PacMan sets off on this tick if he's still.
+_PRIVATE void give_input(Batch *const b, const Surroundings *const s, Vec input)
+{
+    const Vec asked = b->live & MASK(input != PM_MOV_NONE);
+    b->next_dir = select(asked, select(MASK(input == b->dir), SPLAT(PM_MOV_NONE), input), b->next_dir);
+
+    const Vec sets_off = asked & MASK(b->dir == PM_MOV_NONE) & ~is_blocked(b, s, b->next_dir);
+    b->step_acc = select(sets_off, SPLAT(PM_SPEED_STEP - b->pacman_speed), b->step_acc);
+}
+
+// pacman_mover, for the games whose PacMan takes a step: turns, moves him, eats what he finds,
+// and ends the games won.
+_PRIVATE void move_pacman(Batch *const b, const Surroundings *const s, Vec stepping)
+{
+    const Vec turning = stepping & b->live & ~is_blocked(b, s, b->next_dir);
+    b->dir = select(turning, b->next_dir, b->dir);
+    b->next_dir = select(turning, SPLAT(PM_MOV_NONE), b->next_dir);
+
+    const Vec moving = stepping & b->live & MASK(b->dir != PM_MOV_NONE);
+    const Vec blocked = moving & is_blocked(b, s, b->dir);
+    b->dir = select(blocked, SPLAT(PM_MOV_NONE), b->dir);
+
+    const Vec go = moving & ~blocked;
+    const Vec up = MASK(b->dir == PM_MOV_UP), down = MASK(b->dir == PM_MOV_DOWN);
+    const Vec left = MASK(b->dir == PM_MOV_LEFT), right = MASK(b->dir == PM_MOV_RIGHT);
+
+    // Masks are all ones, i.e. -1: adding one steps back.
+    const Vec col_left = select(MASK((s->portals & (s->bit >> 1)) != 0), SPLAT(PM_MAZE_SCALED_WIDTH - 2), b->col - 1);
+    const Vec col_right = select(MASK((s->portals & (s->bit << 1)) != 0), SPLAT(1), b->col + 1);
+    b->row = select(go, b->row + up - down, b->row);
+    b->col = select(go & left, col_left, select(go & right, col_right, b->col));
+
+    // Eating the pill in the new cell, if any, and counting the ones left.
+    const Vec bit = SPLAT(1) << b->col;
+    Vec eaten_pill = {0}, eaten_super = {0}, remaining = {0}, m;
+    for (u8 r = 0; r < PM_MAZE_SCALED_HEIGHT; r++)
+    {
+        m = go & MASK(b->row == r) & bit;
+        eaten_pill |= b->pills[r] & m;
+        eaten_super |= b->super_pills[r] & m;
+        b->pills[r] &= ~m;
+        b->super_pills[r] &= ~m;
+        remaining |= b->pills[r] | b->super_pills[r];
+    }
+
+    eaten_pill = MASK(eaten_pill != 0);
+    eaten_super = MASK(eaten_super != 0);
+    b->score += (eaten_pill & PM_STD_PILL_POINTS) + (eaten_super & PM_SUP_PILL_POINTS);
+    b->pills_eaten -= eaten_pill | eaten_super;
+
+    // The game is won, PacMan stays where he is.
+    const Vec won = (eaten_pill | eaten_super) & MASK(remaining == 0) & MASK(b->super_pills_to_spawn == 0);
+    b->victory |= won;
+    b->live &= ~won;
+}
+
+// The TIMER_SECOND and TIMER_SUPER_PILL timers of the core, which fire on the same ticks: the
+// games still running are lost when the time is up.
+_PRIVATE void count_down(Batch *const b)
+{
+    if (b->game_over_in == 0)
+    {
+        b->live = SPLAT(0);
+        return;
+    }
+
+    b->game_over_in--;
+
+    // The super pill replaces the standard pill in its cell, if it's still there.
+    Vec m, cell;
+    for (u8 i = 0; i < PM_SUP_PILL_COUNT; i++)
+    {
+        m = b->live & MASK(b->super_pill_sec[i] == b->game_over_in);
+        if (!any(m))
+            continue;
+
+        b->super_pills_to_spawn += m;
+        for (u8 r = 0; r < PM_MAZE_SCALED_HEIGHT; r++)
+        {
+            cell = m & MASK(b->super_pill_row[i] == r) & (SPLAT(1) << b->super_pill_col[i]);
+            b->pills[r] &= ~cell;
+            b->super_pills[r] |= cell;
+        }
+    }
+}
+
+// PUBLIC FUNCTIONS
+
+unsigned long long batch_play(PM_Speed speed, const u32 *seeds, u32 count, GameResult *const results[])
+{
+    static _Thread_local Batch b;
+    memset(&b, 0, sizeof(b));
+
+    // The mazes and the super pills are set up by the core, one game at a time.
+    const PM_Game *const game = PM_CoreGetGame();
+    for (u32 l = 0; l < count && l < BATCH_LANES; l++)
+    {
+        PM_CoreNewGame(speed, seeds[l]);
+        for (u8 r = 0; r < PM_MAZE_SCALED_HEIGHT; r++)
+        {
+            b.pills[r][l] = game->maze.pills[r];
+            b.super_pills[r][l] = game->maze.super_pills[r];
+        }
+
+        for (u8 i = 0; i < PM_SUP_PILL_COUNT; i++)
+        {
+            b.super_pill_row[i][l] = game->super_pills[i].cell.row;
+            b.super_pill_col[i][l] = game->super_pills[i].cell.col;
+            b.super_pill_sec[i][l] = game->super_pills[i].spawn_sec;
+        }
+
+        b.super_pills_to_spawn[l] = game->super_pills_to_spawn;
+        b.row[l] = game->pacman.cell.row;
+        b.col[l] = game->pacman.cell.col;
+        b.rng[l] = bot_seed(seeds[l]);
+        b.live[l] = ~0u;
+
+        memcpy(sWalls, game->maze.tiles->walls, sizeof(sWalls));
+        memcpy(sPortals, game->maze.tiles->portals, sizeof(sPortals));
+    }
+
+    b.pacman_speed = game->pacman.speed;
+    b.game_over_in = game->stat_values.game_over_in;
+
+    // PM_CoreStep, until every game is over.
+    const unsigned long long start = thread_cpu_ns();
+    Surroundings s;
+    Vec input, stepping;
+    while (any(b.live))
+    {
+        b.ticks -= b.live;
+
+        // PacMan doesn't move between the bot and pacman_mover, so they share his surroundings.
+        s = surroundings(&b);
+        input = random_bot(&b, &s);
+        give_input(&b, &s, input);
+
+        // take_step, which pacman_mover runs whether PacMan moves or not.
+        b.step_acc += b.pacman_speed;
+        stepping = MASK(b.step_acc >= PM_SPEED_STEP);
+        b.step_acc -= stepping & PM_SPEED_STEP;
+        if (any(stepping & b.live))
+            move_pacman(&b, &s, stepping);
+
+        if (++b.game_over_elapsed >= PM_TICKS_PER_SEC)
+        {
+            b.game_over_elapsed = 0;
+            count_down(&b);
+        }
+    }
+
+    const unsigned long long elapsed = thread_cpu_ns() - start;
+    for (u32 l = 0; l < count && l < BATCH_LANES; l++)
+    {
+        *results[l] = (GameResult){
+            .score = b.score[l],
+            .pills_eaten = b.pills_eaten[l],
+            .ticks = b.ticks[l],
+            .is_victory = b.victory[l],
+        };
+    }
+
+    return elapsed;
+}
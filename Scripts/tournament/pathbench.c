@@ -0,0 +1,548 @@
+/*
+ * Host-side benchmark and optimality test of the ghost pathfinding (pacman_path.c). For every walkable
+ * (start, goal) pair of the base maze, a ghost is walked from the start with PacMan standing still on
+ * the goal, through PM_PathGhostNextCell like pacman_core.c does. Each path is checked against a plain
+ * BFS, and the expansions, the allocations, the time and the length of each one are reported. The
+ * same pairs are searched by the A* of the first version of the game too (see BASELINE), to compare.
+ *
+ * The cells out of reach of each other, e.g. past the teleporters that the ghosts don't take, are
+ * left out.
+ *
+ * Usage: pathbench [-c]
+ * With -c a CSV line is printed for each pair too. The strategy is the one pacman_path.c is built with
+ * (see PATHING in the Makefile). Exits with 1 if any path is not a shortest one.
+ */
+
+#include "pacman_path.h"
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Images
+#include "Assets/Images/pacman-maze.h"
+
+// PRIVATE DEFINES
+
+#define MAX_CALLS_PER_PAIR (4 * PM_MAZE_CELL_COUNT) // Way more than a path takes, searches pending included
+#define MAX_FAILURES_SHOWN 10
+#define NO_DISTANCE 0xFFFF
+
+// PRIVATE TYPES
+
+// The A* of the first version, per cell, with the f, g and h of each one.
+typedef struct BaselineNode
+{
+    PM_MazeCell cell;
+    u16 f, g, h;
+    struct BaselineNode *parent;
+} BaselineNode;
+
+typedef int (*CompareFn)(const void *a, const void *b);
+
+// Generic binary heap of items of any size, ordered through a function pointer, like CL_PQueue.
+typedef struct
+{
+    u8 *items;
+    u32 count, capacity;
+    size_t item_size;
+    CompareFn compare;
+} BaselineQueue;
+
+// Path of the baseline, one allocated node per cell, like CL_List.
+typedef struct BaselineStep
+{
+    PM_MazeCell cell;
+    struct BaselineStep *next;
+} BaselineStep;
+
+typedef struct
+{
+    u16 length;   // Steps the ghost took to the goal
+    u16 calls;    // Calls to PM_PathGhostNextCell, the ones waiting on a pending search included
+    u32 expansions, allocs, bytes;
+    u32 ns;
+    bool is_valid; // Reached the goal, one step at a time over walkable cells
+} PairResult;
+
+// STATE VARIABLES
+
+_PRIVATE PM_MazeTiles sTiles;
+_PRIVATE u16 sDistances[PM_MAZE_SCALED_HEIGHT][PM_MAZE_SCALED_WIDTH]; // From the start of the BFS
+_PRIVATE u32 sAllocs, sAllocBytes;
+
+// ALLOCATION COUNTERS
+
+// The binary is linked with --wrap for these, so that every allocation of the code under test is counted.
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+void *__wrap_malloc(size_t size)
+{
+    sAllocs++;
+    sAllocBytes += size;
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size)
+{
+    sAllocs++;
+    sAllocBytes += count * size;
+    return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size)
+{
+    sAllocs++;
+    sAllocBytes += size;
+    return __real_realloc(ptr, size);
+}
+
+// UTILS
+
+_PRIVATE unsigned long long now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+_PRIVATE int compare_u32(const void *a, const void *b)
+{
+    const u32 x = *(const u32 *)a, y = *(const u32 *)b;
+    return (x > y) - (x < y);
+}
+
+// Whether the ghosts can stand on the cell, i.e. it's neither a wall nor a teleporter (see pacman_path.c).
+_PRIVATE bool is_walkable(PM_MazeCell cell)
+{
+    if (cell.row >= PM_MAZE_SCALED_HEIGHT || cell.col >= PM_MAZE_SCALED_WIDTH)
+        return false;
+
+    return !((sTiles.walls[cell.row] | sTiles.portals[cell.row]) & PM_MAZE_BIT(cell.col));
+}
+
+// The same as load_maze in pacman_core.c, for the tiles only.
+_PRIVATE void load_tiles(void)
+{
+    for (u16 row = 0; row < PM_MAZE_SCALED_HEIGHT; row++)
+    {
+        for (u16 col = 0; col < PM_MAZE_SCALED_WIDTH; col++)
+        {
+            switch (PACMAN_BaseMaze[row][col])
+            {
+            case PM_WALL:
+                sTiles.walls[row] |= PM_MAZE_BIT(col);
+                break;
+            case PM_LTPL:
+            case PM_RTPL:
+                sTiles.portals[row] |= PM_MAZE_BIT(col);
+                break;
+            case PM_PCMN:
+                sTiles.pacman_spawn = (PM_MazeCell){row, col};
+                break;
+            case PM_GHSR:
+                sTiles.ghost_spawn = (PM_MazeCell){row, col};
+                break;
+            default:
+                break;
+            }
+        }
+    }
+}
+
+// REFERENCE
+
+// Plain BFS from the start over the walkable cells: the length of a shortest path to each one.
+_PRIVATE void bfs_distances(PM_MazeCell start)
+{
+    static const i16 d_row[] = {-1, 1, 0, 0}, d_col[] = {0, 0, -1, 1};
+
+    PM_MazeCell queue[PM_MAZE_CELL_COUNT], cell, next;
+    u16 head = 0, tail = 0;
+
+    memset(sDistances, 0xFF, sizeof(sDistances));
+    sDistances[start.row][start.col] = 0;
+    queue[tail++] = start;
+    while (head < tail)
+    {
+        cell = queue[head++];
+        for (u8 dir = 0; dir < 4; dir++)
+        {
+            next = (PM_MazeCell){cell.row + d_row[dir], cell.col + d_col[dir]};
+            if (!is_walkable(next) || sDistances[next.row][next.col] != NO_DISTANCE)
+                continue;
+
+            sDistances[next.row][next.col] = sDistances[cell.row][cell.col] + 1;
+            queue[tail++] = next;
+        }
+    }
+}
+
+// BASELINE
+
+/*
+The A* that find_path_to_goal ran before the bucket queue, rebuilt on the host: BigLib is only built for
+the board, so a binary heap and a linked list with the same allocation pattern stand in for its
+CL_PQueue and CL_List. Each search allocates the queue, grows it as it goes, and allocates a node of
+the path for each cell of it. The nodes are compared through a function pointer, and the node tables
+are cleared with memsets.
+
+As in the original, a node whose cost improves is updated in place while the queue still holds it, which
+breaks the order of the heap: a few of the paths found are longer than the shortest ones, hence the
+baseline is reported but doesn't fail the test.
+*/
+
+_PRIVATE int compare_f_values(const void *a, const void *b)
+{
+    const BaselineNode *node_a = *(const BaselineNode **)a;
+    const BaselineNode *node_b = *(const BaselineNode **)b;
+    return (int)node_a->f - (int)node_b->f;
+}
+
+_PRIVATE BaselineQueue *baseline_queue_alloc(size_t item_size, CompareFn compare)
+{
+    BaselineQueue *const queue = malloc(sizeof(BaselineQueue));
+    if (queue)
+        *queue = (BaselineQueue){.items = NULL, .count = 0, .capacity = 0, .item_size = item_size, .compare = compare};
+
+    return queue;
+}
+
+_PRIVATE void baseline_queue_free(BaselineQueue *const queue)
+{
+    free(queue->items);
+    free(queue);
+}
+
+_PRIVATE void baseline_queue_swap(BaselineQueue *const queue, u32 i, u32 j)
+{
+    u8 tmp[16];
+    memcpy(tmp, queue->items + i * queue->item_size, queue->item_size);
+    memcpy(queue->items + i * queue->item_size, queue->items + j * queue->item_size, queue->item_size);
+    memcpy(queue->items + j * queue->item_size, tmp, queue->item_size);
+}
+
+_PRIVATE bool baseline_queue_enqueue(BaselineQueue *const queue, const void *item)
+{
+    if (queue->count == queue->capacity)
+    {
+        const u32 capacity = queue->capacity ? queue->capacity * 2 : 8;
+        u8 *const items = realloc(queue->items, capacity * queue->item_size);
+        if (!items)
+            return false;
+
+        queue->items = items;
+        queue->capacity = capacity;
+    }
+
+    u32 i = queue->count++;
+    memcpy(queue->items + i * queue->item_size, item, queue->item_size);
+    for (u32 parent; i > 0; i = parent)
+    {
+        parent = (i - 1) / 2;
+        if (queue->compare(queue->items + parent * queue->item_size, queue->items + i * queue->item_size) <= 0)
+            break;
+
+        baseline_queue_swap(queue, i, parent);
+    }
+
+    return true;
+}
+
+_PRIVATE void baseline_queue_dequeue(BaselineQueue *const queue, void *out_item)
+{
+    memcpy(out_item, queue->items, queue->item_size);
+    if (--queue->count == 0)
+        return;
+
+    memcpy(queue->items, queue->items + queue->count * queue->item_size, queue->item_size);
+    for (u32 i = 0, child; (child = 2 * i + 1) < queue->count; i = child)
+    {
+        if (child + 1 < queue->count &&
+            queue->compare(queue->items + (child + 1) * queue->item_size, queue->items + child * queue->item_size) < 0)
+            child++;
+
+        if (queue->compare(queue->items + i * queue->item_size, queue->items + child * queue->item_size) <= 0)
+            break;
+
+        baseline_queue_swap(queue, i, child);
+    }
+}
+
+_PRIVATE inline u16 baseline_heuristic(PM_MazeCell a, PM_MazeCell b)
+{
+    return abs((i16)a.row - b.row) + abs((i16)a.col - b.col);
+}
+
+// Backtracks from the goal to the start through the parents, pushing each cell in front of the path.
+_PRIVATE BaselineStep *baseline_reconstruct_path(BaselineNode *const goal)
+{
+    BaselineStep *path = NULL, *step;
+    for (BaselineNode *node = goal; node; node = node->parent)
+    {
+        if (!(step = malloc(sizeof(BaselineStep))))
+            break;
+
+        *step = (BaselineStep){node->cell, path};
+        path = step;
+    }
+
+    return path;
+}
+
+// Returns the path from the start to the goal, both included, or NULL if there's none.
+_PRIVATE BaselineStep *baseline_find_path(PM_MazeCell start, PM_MazeCell goal, u32 *out_expansions)
+{
+    static const i16 d_row[] = {-1, 1, 0, 0}, d_col[] = {0, 0, -1, 1};
+    static bool visited[PM_MAZE_SCALED_HEIGHT][PM_MAZE_SCALED_WIDTH];
+    static BaselineNode nodes[PM_MAZE_SCALED_HEIGHT][PM_MAZE_SCALED_WIDTH];
+
+    BaselineQueue *const open_set = baseline_queue_alloc(sizeof(BaselineNode *), compare_f_values);
+    if (!open_set)
+        return NULL;
+
+    memset(visited, 0, sizeof(visited));
+    memset(nodes, 0, sizeof(nodes));
+
+    const u16 h = baseline_heuristic(start, goal);
+    BaselineNode *const start_node = &nodes[start.row][start.col];
+    *start_node = (BaselineNode){start, h, 0, h, NULL};
+    baseline_queue_enqueue(open_set, &start_node);
+
+    BaselineNode *cur, *neigh;
+    PM_MazeCell cell;
+    u16 new_g;
+    while (open_set->count)
+    {
+        baseline_queue_dequeue(open_set, &cur);
+        if (visited[cur->cell.row][cur->cell.col])
+            continue;
+
+        visited[cur->cell.row][cur->cell.col] = true;
+        if (cur->cell.row == goal.row && cur->cell.col == goal.col)
+        {
+            BaselineStep *const path = baseline_reconstruct_path(cur);
+            baseline_queue_free(open_set);
+            return path;
+        }
+
+        (*out_expansions)++;
+        for (u8 dir = 0; dir < 4; dir++)
+        {
+            cell = (PM_MazeCell){cur->cell.row + d_row[dir], cur->cell.col + d_col[dir]};
+            if (!is_walkable(cell) || visited[cell.row][cell.col])
+                continue;
+
+            // A node with g = 0 that isn't the start one has not been reached yet.
+            new_g = cur->g + 1;
+            neigh = &nodes[cell.row][cell.col];
+            if ((!neigh->g && neigh != start_node) || new_g < neigh->g)
+            {
+                *neigh = (BaselineNode){cell, new_g + baseline_heuristic(cell, goal), new_g,
+                                        baseline_heuristic(cell, goal), cur};
+                baseline_queue_enqueue(open_set, &neigh);
+            }
+        }
+    }
+
+    baseline_queue_free(open_set);
+    return NULL;
+}
+
+// Searches the path with the baseline, then follows it to the goal, freeing it step by step.
+_PRIVATE PairResult walk_baseline(PM_MazeCell start, PM_MazeCell goal)
+{
+    PairResult result = {.is_valid = true};
+    const u32 allocs = sAllocs, bytes = sAllocBytes;
+    const unsigned long long start_ns = now_ns();
+
+    BaselineStep *path = baseline_find_path(start, goal, &result.expansions), *step;
+    PM_MazeCell cell = start;
+    result.calls = 1;
+    result.is_valid = path != NULL;
+    while (path)
+    {
+        step = path;
+        path = path->next;
+        if (step->cell.row != cell.row || step->cell.col != cell.col)
+        {
+            result.is_valid &= baseline_heuristic(cell, step->cell) == 1;
+            cell = step->cell;
+            result.length++;
+        }
+
+        free(step);
+    }
+
+    result.ns = now_ns() - start_ns;
+    result.allocs = sAllocs - allocs;
+    result.bytes = sAllocBytes - bytes;
+    result.is_valid &= cell.row == goal.row && cell.col == goal.col;
+    return result;
+}
+
+// BENCHMARK
+
+// Walks a ghost from the start to PacMan, standing on the goal. The pathfinding starts anew for each
+// pair, with no search tree to reuse and its counters cleared.
+_PRIVATE PairResult walk_ghost(PM_MazeCell start, PM_MazeCell goal)
+{
+    PM_PathLoadMaze(&sTiles);
+    PM_PathUpdatePacMan(goal);
+
+    PairResult result = {.is_valid = true};
+    PM_Ghost ghost = {.cell = start, .prev_cell = start};
+    PM_MazeCell next;
+    const u32 allocs = sAllocs, bytes = sAllocBytes;
+    const unsigned long long start_ns = now_ns();
+    while ((ghost.cell.row != goal.row || ghost.cell.col != goal.col) && result.calls < MAX_CALLS_PER_PAIR)
+    {
+        result.calls++;
+        if (!PM_PathGhostNextCell(&ghost, &next))
+            continue;
+
+        const u16 d_row = abs((i16)next.row - ghost.cell.row), d_col = abs((i16)next.col - ghost.cell.col);
+        result.is_valid &= d_row + d_col == 1 && is_walkable(next);
+        ghost.prev_cell = ghost.cell;
+        ghost.cell = next;
+        result.length++;
+    }
+
+    result.ns = now_ns() - start_ns;
+    result.allocs = sAllocs - allocs;
+    result.bytes = sAllocBytes - bytes;
+    result.expansions = PM_PathGetStats().expansions;
+    result.is_valid &= ghost.cell.row == goal.row && ghost.cell.col == goal.col;
+    return result;
+}
+
+_PRIVATE const char *pathing_name(void)
+{
+    switch (PM_GHOST_PATHING)
+    {
+    case PM_PATHING_NEXT_HOP:
+        return "next-hop table";
+    case PM_PATHING_FLOW_FIELD:
+        return "flow field";
+    case PM_PATHING_ASTAR:
+        return "A*";
+    default:
+        return "unknown";
+    }
+}
+
+// MAIN
+
+int main(int argc, char **argv)
+{
+    bool csv = false;
+    int opt;
+    while ((opt = getopt(argc, argv, "c")) != -1)
+    {
+        if (opt != 'c')
+        {
+            fprintf(stderr, "usage: %s [-c]\n", argv[0]);
+            return 2;
+        }
+
+        csv = true;
+    }
+
+    load_tiles();
+
+    PM_MazeCell cells[PM_MAZE_CELL_COUNT];
+    u16 cell_count = 0;
+    for (u16 row = 0; row < PM_MAZE_SCALED_HEIGHT; row++)
+        for (u16 col = 0; col < PM_MAZE_SCALED_WIDTH; col++)
+            if (is_walkable((PM_MazeCell){row, col}))
+                cells[cell_count++] = (PM_MazeCell){row, col};
+
+    u32 *const times = malloc((u32)cell_count * cell_count * sizeof(u32));
+    if (!times)
+        return 1;
+
+    if (csv)
+        printf("start_row,start_col,goal_row,goal_col,length,bfs_length,calls,expansions,allocs,bytes,ns,"
+               "baseline_expansions,baseline_allocs,baseline_bytes,baseline_ns\n");
+
+    unsigned long long expansions = 0, allocs = 0, bytes = 0, lengths = 0, calls = 0, total_ns = 0;
+    u32 pairs = 0, unreachable = 0, failures = 0, max_expansions = 0, max_length = 0;
+    unsigned long long base_expansions = 0, base_allocs = 0, base_bytes = 0, base_ns = 0;
+    u32 base_failures = 0;
+    PairResult result, baseline;
+    for (u16 s = 0; s < cell_count; s++)
+    {
+        bfs_distances(cells[s]);
+        for (u16 g = 0; g < cell_count; g++)
+        {
+            if (g == s)
+                continue;
+
+            const PM_MazeCell start = cells[s], goal = cells[g];
+            const u16 bfs_length = sDistances[goal.row][goal.col];
+            if (bfs_length == NO_DISTANCE)
+            {
+                unreachable++;
+                continue;
+            }
+
+            result = walk_ghost(start, goal);
+            if (!result.is_valid || result.length != bfs_length)
+            {
+                if (failures++ < MAX_FAILURES_SHOWN)
+                    fprintf(stderr, "not a shortest path: (%u, %u) to (%u, %u), %s%u steps instead of %u\n",
+                            start.row, start.col, goal.row, goal.col, result.is_valid ? "" : "invalid, ",
+                            result.length, bfs_length);
+            }
+
+            baseline = walk_baseline(start, goal);
+            base_failures += !baseline.is_valid || baseline.length != bfs_length;
+            base_expansions += baseline.expansions;
+            base_allocs += baseline.allocs;
+            base_bytes += baseline.bytes;
+            base_ns += baseline.ns;
+
+            if (csv)
+                printf("%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u\n", start.row, start.col, goal.row, goal.col,
+                       result.length, bfs_length, result.calls, result.expansions, result.allocs, result.bytes,
+                       result.ns, baseline.expansions, baseline.allocs, baseline.bytes, baseline.ns);
+
+            expansions += result.expansions;
+            allocs += result.allocs;
+            bytes += result.bytes;
+            lengths += result.length;
+            calls += result.calls;
+            total_ns += result.ns;
+            max_expansions = (result.expansions > max_expansions) ? result.expansions : max_expansions;
+            max_length = (result.length > max_length) ? result.length : max_length;
+            times[pairs++] = result.ns;
+        }
+    }
+
+    qsort(times, pairs, sizeof(u32), compare_u32);
+
+    // With -c the summary goes to stderr, so that stdout is the CSV alone.
+    FILE *const out = csv ? stderr : stdout;
+    fprintf(out, "pathbench   %s (PM_GHOST_PATHING=%d), %u walkable cells, %u pairs, %u more out of reach\n",
+            pathing_name(), PM_GHOST_PATHING, cell_count, pairs, unreachable);
+    fprintf(out, "expansions  %.1f per pair on average, %u at most\n", (double)expansions / pairs, max_expansions);
+    fprintf(out, "allocations %llu, %llu bytes\n", allocs, bytes);
+    fprintf(out, "time        %.0f ns per pair on average, p50 %u, p99 %u, max %u\n", (double)total_ns / pairs,
+            times[pairs / 2], times[(u32)(pairs * 0.99)], times[pairs - 1]);
+    fprintf(out, "length      %.1f steps on average, %u at most, %.2f calls per step\n", (double)lengths / pairs,
+            max_length, (double)calls / lengths);
+    fprintf(out, "optimality  %u of %u pairs on a shortest path\n", pairs - failures, pairs);
+
+    // The expansions of the baseline are cells, the ones of pacman_path.c junctions of the maze.
+    fprintf(out, "baseline    A* per cell with allocated containers: %.1f expansions, %.1f allocations (%.0f bytes), "
+                 "%.0f ns per pair on average (%.1fx), %u of %u pairs on a shortest path\n",
+            (double)base_expansions / pairs, (double)base_allocs / pairs, (double)base_bytes / pairs,
+            (double)base_ns / pairs, (double)base_ns / total_ns, pairs - base_failures, pairs);
+
+    free(times);
+    return failures ? 1 : 0;
+}
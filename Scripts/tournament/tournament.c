@@ -0,0 +1,782 @@
+/*
+ * Host-side bot tournament: plays thousands of complete games with the rules of pacman_core.c,
+ * spread over all the cores, and reports the throughput and the distribution of the results.
+ * The core and the pathfinding keep their state per thread (see PM_HOST_BUILD in pacman_types.h).
+ *
+ * Usage: tournament [-n games] [-j threads] [-b greedy|random] [-s fast|normal|slow] [-S seed] [-B] [-R]
+ * Game i is played with seed S + i, so the results don't depend on the number of threads.
+ * With -B the random bot plays the games one at a time first, then BATCH_LANES at a time in
+ * lockstep (see batch.c), and the two runs are compared in throughput. The lockstep simulator only
+ * plays ghost-free games: they're not the games of the core, and its results are reported apart.
+ * With -R each game is recorded (see pacman_replay.h), with pauses now and then, then played back
+ * from the recording: the replay must end in the same state, after the same ticks and events.
+ */
+
+#include "tournament.h"
+#include "pacman_path.h"
+#include "pacman_replay.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <time.h>
+#include <unistd.h>
+
+// PRIVATE DEFINES
+
+#define MAX_WORKERS 256
+#define MAX_TICKS_PER_GAME 100000 // Safety net, a game lasts at most 60 playing seconds anyway
+#define REPLAY_PAUSE_ODDS 300     // With -R, the game is paused or resumed once every this many ticks on average
+
+// PRIVATE TYPES
+
+/// @brief State of a bot, set up anew for each game so that the game only depends on its seed.
+typedef struct
+{
+    u32 rng;
+    PM_MazeCell last_cell; // Cell of the last decision, for the bots turning once per cell
+} BotState;
+
+typedef PM_Input (*Bot)(const PM_Game *const game, BotState *const bot);
+
+/// @brief Games left to a worker, as the range [next, end). The owner takes games from
+///        the front, while the other workers steal the back half once they run dry.
+typedef struct
+{
+    pthread_mutex_t lock;
+    u32 next, end;
+    pthread_t thread;
+    u32 games_played, games_stolen;
+    unsigned long long step_ns; // CPU time spent stepping the games, without setting them up
+    PM_PathStats path_stats;
+} Worker;
+
+// STATE VARIABLES
+
+_PRIVATE Worker sWorkers[MAX_WORKERS];
+_PRIVATE u32 sWorkerCount;
+_PRIVATE GameResult *sResults;
+
+_PRIVATE Bot sBot;
+_PRIVATE bool sBatched, sReplayed;
+_PRIVATE PM_Speed sSpeed = PM_SPEED_NORMAL;
+_PRIVATE u32 sSeed = 1;
+
+// UTILS
+
+_PRIVATE u32 rng_next(u32 *state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+_PRIVATE double cpu_sec(void)
+{
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_utime.tv_sec + usage.ru_utime.tv_usec * 1e-6;
+}
+
+_PRIVATE double now_sec(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+_PRIVATE inline bool is_wall(const PM_Maze *const maze, PM_MazeCell cell)
+{
+    return maze->tiles->walls[cell.row] & PM_MAZE_BIT(cell.col);
+}
+
+// Returns the cell PacMan would reach from `cell` along `dir`, following the rules of pacman_mover.
+_PRIVATE bool step(const PM_Maze *const maze, PM_MazeCell cell, PM_MovementDir dir, PM_MazeCell *out)
+{
+    PM_MazeCell next = cell;
+    switch (dir)
+    {
+    case PM_MOV_UP:
+        if (cell.row == 0)
+            return false;
+        next.row--;
+        break;
+    case PM_MOV_DOWN:
+        if (cell.row == PM_MAZE_SCALED_HEIGHT - 1)
+            return false;
+        next.row++;
+        break;
+    case PM_MOV_LEFT:
+        if (cell.col == 0)
+            return false;
+        next.col--;
+        break;
+    case PM_MOV_RIGHT:
+        if (cell.col == PM_MAZE_SCALED_WIDTH - 1)
+            return false;
+        next.col++;
+        break;
+    default:
+        return false;
+    }
+
+    if (is_wall(maze, next))
+        return false;
+
+    // Walking into a portal teleports to the other side.
+    if (maze->tiles->portals[next.row] & PM_MAZE_BIT(next.col))
+        next.col = (dir == PM_MOV_LEFT) ? PM_MAZE_SCALED_WIDTH - 2 : 1;
+
+    *out = next;
+    return true;
+}
+
+// BOTS
+
+// Keeps its direction, and picks a random one when stopped, or now and then at a crossing.
+_PRIVATE PM_Input random_bot(const PM_Game *const game, BotState *const bot)
+{
+    PM_Input input = {.dir = PM_MOV_NONE, .toggle_pause = false};
+    if (game->pacman.dir != PM_MOV_NONE && rng_next(&bot->rng) % 8)
+        return input;
+
+    PM_MazeCell next;
+    const PM_MovementDir dir = (PM_MovementDir)(PM_MOV_UP + rng_next(&bot->rng) % 4);
+    if (step(&game->maze, game->pacman.cell, dir, &next))
+        input.dir = dir;
+
+    return input;
+}
+
+// Heads for the closest pill of any kind, along a shortest path found with a BFS.
+_PRIVATE PM_Input greedy_bot(const PM_Game *const game, BotState *const bot)
+{
+    PM_Input input = {.dir = PM_MOV_NONE, .toggle_pause = false};
+    const PM_MazeCell start = game->pacman.cell;
+
+    // PacMan only changes direction when he reaches a new cell, or after stopping.
+    if (game->pacman.dir != PM_MOV_NONE && start.row == bot->last_cell.row && start.col == bot->last_cell.col)
+        return input;
+
+    // BFS over the cells, remembering the first move of the path to each one.
+    u8 first_dir[PM_MAZE_SCALED_HEIGHT][PM_MAZE_SCALED_WIDTH] = {0};
+    PM_MazeCell queue[PM_MAZE_CELL_COUNT], cell, next;
+    u16 head = 0, tail = 0;
+
+    first_dir[start.row][start.col] = 0xFF;
+    queue[tail++] = start;
+    while (head < tail)
+    {
+        cell = queue[head++];
+        if (head > 1 && ((game->maze.pills[cell.row] | game->maze.super_pills[cell.row]) & PM_MAZE_BIT(cell.col)))
+        {
+            input.dir = (PM_MovementDir)first_dir[cell.row][cell.col];
+            break;
+        }
+
+        for (PM_MovementDir dir = PM_MOV_UP; dir <= PM_MOV_RIGHT; dir++)
+        {
+            if (!step(&game->maze, cell, dir, &next) || first_dir[next.row][next.col])
+                continue;
+
+            first_dir[next.row][next.col] = (head == 1) ? dir : first_dir[cell.row][cell.col];
+            queue[tail++] = next;
+        }
+    }
+
+    // With no pills left to reach, wandering is all that's left.
+    if (input.dir == PM_MOV_NONE)
+        return random_bot(game, bot);
+
+    bot->last_cell = start;
+    return input;
+}
+
+// REPLAYS
+
+// Hash of the events of a tick, chained over the ticks of a game. PM_EVT_NEW_RECORD is left out, since
+// it depends on the record of the game played before, i.e. on something a replay doesn't hold.
+_PRIVATE inline u32 hash_events(u32 hash, const PM_Events *const events)
+{
+    return (hash ^ (events->flags & ~PM_EVT_NEW_RECORD)) * 16777619u;
+}
+
+// Whether two games ended in the same state, field by field so that the padding is left out. So is
+// prev_record, kept from the game played before.
+_PRIVATE bool games_match(const PM_Game *const a, const PM_Game *const b)
+{
+    bool match = a->is_over == b->is_over && a->playing_now == b->playing_now &&
+                 !memcmp(&a->stat_values, &b->stat_values, sizeof(PM_GameStatValues)) &&
+                 !memcmp(a->maze.pills, b->maze.pills, sizeof(PM_MazeRows)) &&
+                 !memcmp(a->maze.super_pills, b->maze.super_pills, sizeof(PM_MazeRows)) &&
+                 a->super_pills_to_spawn == b->super_pills_to_spawn;
+
+    const PM_PacMan *const pa = &a->pacman, *const pb = &b->pacman;
+    match &= !memcmp(&pa->cell, &pb->cell, sizeof(PM_MazeCell)) &&
+             !memcmp(&pa->prev_cell, &pb->prev_cell, sizeof(PM_MazeCell)) && pa->dir == pb->dir &&
+             pa->next_dir == pb->next_dir && pa->speed == pb->speed && pa->step_acc == pb->step_acc;
+
+    const PM_Ghost *ga, *gb;
+    for (u8 i = 0; i < PM_GHOST_COUNT; i++)
+    {
+        ga = &a->ghosts[i];
+        gb = &b->ghosts[i];
+        match &= !memcmp(&ga->cell, &gb->cell, sizeof(PM_MazeCell)) &&
+                 !memcmp(&ga->prev_cell, &gb->prev_cell, sizeof(PM_MazeCell)) && ga->speed == gb->speed &&
+                 ga->step_acc == gb->step_acc && ga->is_scared == gb->is_scared;
+    }
+
+    return match;
+}
+
+// Plays the recording back, and compares the game it ends with to the one recorded.
+_PRIVATE bool replay_matches(const PM_Replay *const replay, const PM_Game *const recorded, u32 ticks, u32 hash)
+{
+    PM_ReplayPlayer player;
+    PM_Events events;
+    u32 replay_ticks = 0, replay_hash = 2166136261u;
+    PM_ReplayPlayNewGame(&player, replay);
+    while (PM_ReplayPlayStep(&player, &events))
+    {
+        replay_hash = hash_events(replay_hash, &events);
+        replay_ticks++;
+    }
+
+    return replay_ticks == ticks && replay_hash == hash && games_match(PM_CoreGetGame(), recorded);
+}
+
+// WORK-STEALING POOL
+
+_PRIVATE bool take_game(Worker *const self, u32 *out_game)
+{
+    pthread_mutex_lock(&self->lock);
+    const bool found = self->next < self->end;
+    if (found)
+        *out_game = self->next++;
+
+    pthread_mutex_unlock(&self->lock);
+    return found;
+}
+
+// Moves to `self` the back half of the games left to another worker, the first found with any.
+_PRIVATE bool steal_games(Worker *const self)
+{
+    const u32 start = (u32)(self - sWorkers);
+    for (u32 i = 1; i < sWorkerCount; i++)
+    {
+        Worker *const victim = &sWorkers[(start + i) % sWorkerCount];
+
+        pthread_mutex_lock(&victim->lock);
+        const u32 left = victim->end - victim->next;
+        if (left == 0)
+        {
+            pthread_mutex_unlock(&victim->lock);
+            continue;
+        }
+
+        // The victim keeps at least the game it would take next.
+        const u32 mid = victim->next + (left + 1) / 2;
+        const u32 end = victim->end;
+        victim->end = mid;
+        pthread_mutex_unlock(&victim->lock);
+
+        if (mid == end)
+            continue;
+
+        pthread_mutex_lock(&self->lock);
+        self->next = mid;
+        self->end = end;
+        self->games_stolen += end - mid;
+        pthread_mutex_unlock(&self->lock);
+        return true;
+    }
+
+    return false;
+}
+
+_PRIVATE bool next_game(Worker *const self, u32 *out_game)
+{
+    return take_game(self, out_game) || (steal_games(self) && take_game(self, out_game));
+}
+
+_PRIVATE void play_game(Worker *const self, u32 index)
+{
+    // With -R the game is recorded, and pauses come from a generator of their own, so that the bot plays
+    // the same as without them.
+    PM_Replay replay;
+    u32 pause_rng = bot_seed(~(sSeed + index)), hash = 2166136261u;
+    if (sReplayed)
+        PM_ReplayRecordNewGame(&replay, sSpeed, sSeed + index);
+    else
+        PM_CoreNewGame(sSpeed, sSeed + index);
+
+    const PM_Game *const game = PM_CoreGetGame();
+
+    GameResult *const result = &sResults[index];
+    BotState bot = {.rng = bot_seed(sSeed + index), .last_cell = {0xFF, 0xFF}};
+    bool ghost_on_pacman = false, ghost_was_on_pacman = false;
+    PM_Input input;
+    PM_Events events;
+    const unsigned long long start = thread_cpu_ns();
+    while (!game->is_over && result->ticks < MAX_TICKS_PER_GAME)
+    {
+        input = sBot(game, &bot);
+        if (sReplayed)
+        {
+            input.toggle_pause = rng_next(&pause_rng) % REPLAY_PAUSE_ODDS == 0;
+            events = PM_ReplayRecordStep(&replay, input);
+            hash = hash_events(hash, &events);
+        }
+        else
+            events = PM_CoreStep(input);
+
+        result->is_victory = events.flags & PM_EVT_VICTORY;
+        result->ticks++;
+
+        // A collision puts the ghost back on its spawn cell within the tick, hence it's told by the events.
+        const bool collided = events.flags & (PM_EVT_LIFE_LOST | PM_EVT_GHOST_EATEN);
+        ghost_on_pacman = false;
+        for (u8 i = 0; i < PM_GHOST_COUNT; i++)
+        {
+            const PM_MazeCell ghost = game->ghosts[i].cell;
+            ghost_on_pacman |= ghost.row == game->pacman.cell.row && ghost.col == game->pacman.cell.col;
+        }
+
+        if (collided || (ghost_on_pacman && !ghost_was_on_pacman))
+            result->ghost_contacts++;
+
+        ghost_was_on_pacman = ghost_on_pacman;
+    }
+
+    self->step_ns += thread_cpu_ns() - start;
+    result->score = game->stat_values.score;
+    result->pills_eaten = game->stat_values.pills_eaten;
+
+    // The pathfinding counters are per thread, as its state is, and start over with each game.
+    const PM_PathStats path = PM_PathGetStats();
+    self->path_stats.searches += path.searches;
+    self->path_stats.restarts += path.restarts;
+    self->path_stats.expansions += path.expansions;
+
+    // A truncated recording ends before the game does, hence there's nothing to compare it with.
+    if (sReplayed)
+    {
+        const PM_Game recorded = *game;
+        result->replay_bytes = replay.length;
+        result->replay_truncated = replay.is_truncated;
+        result->replay_differs = !replay.is_truncated && !replay_matches(&replay, &recorded, result->ticks, hash);
+    }
+}
+
+// PROFILER
+
+#ifdef PM_PROFILE
+/*
+ * With `make PROFILE=1`, the core is built with -finstrument-functions, so that each of its functions
+ * calls the hooks below on entry and exit. Each thread keeps a stack of the calls in progress, to
+ * charge every function with its self time only, i.e. without the time of the functions it calls.
+ * The addresses are turned into names by addr2line, at the end.
+ */
+
+#define PROFILE_SLOTS 512 // Open-addressing table of the functions seen, per thread
+#define PROFILE_DEPTH 64
+
+typedef struct
+{
+    void *fn;
+    unsigned long long calls, self_ns;
+} ProfileSlot;
+
+typedef struct
+{
+    void *fn;
+    unsigned long long start_ns, child_ns;
+} ProfileFrame;
+
+_PRIVATE _Thread_local ProfileSlot tProfile[PROFILE_SLOTS];
+_PRIVATE _Thread_local ProfileFrame tStack[PROFILE_DEPTH];
+_PRIVATE _Thread_local u32 tDepth;
+
+_PRIVATE ProfileSlot sProfile[PROFILE_SLOTS];
+_PRIVATE pthread_mutex_t sProfileLock = PTHREAD_MUTEX_INITIALIZER;
+
+__attribute__((no_instrument_function)) _PRIVATE inline unsigned long long profile_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+__attribute__((no_instrument_function)) _PRIVATE ProfileSlot *profile_slot(ProfileSlot *table, void *fn)
+{
+    u32 i = (u32)(((unsigned long)fn >> 4) * 2654435761u) % PROFILE_SLOTS;
+    while (table[i].fn && table[i].fn != fn)
+        i = (i + 1) % PROFILE_SLOTS;
+
+    table[i].fn = fn;
+    return &table[i];
+}
+
+__attribute__((no_instrument_function)) void __cyg_profile_func_enter(void *fn, void *call_site)
+{
+    if (tDepth < PROFILE_DEPTH)
+        tStack[tDepth] = (ProfileFrame){fn, profile_now(), 0};
+
+    tDepth++;
+}
+
+__attribute__((no_instrument_function)) void __cyg_profile_func_exit(void *fn, void *call_site)
+{
+    if (--tDepth >= PROFILE_DEPTH)
+        return;
+
+    const ProfileFrame *const frame = &tStack[tDepth];
+    const unsigned long long elapsed = profile_now() - frame->start_ns;
+
+    ProfileSlot *const slot = profile_slot(tProfile, fn);
+    slot->calls++;
+    slot->self_ns += elapsed - frame->child_ns;
+
+    if (tDepth > 0)
+        tStack[tDepth - 1].child_ns += elapsed;
+}
+
+_PRIVATE void profile_flush(void)
+{
+    pthread_mutex_lock(&sProfileLock);
+    for (u32 i = 0; i < PROFILE_SLOTS; i++)
+    {
+        if (!tProfile[i].fn)
+            continue;
+
+        ProfileSlot *const slot = profile_slot(sProfile, tProfile[i].fn);
+        slot->calls += tProfile[i].calls;
+        slot->self_ns += tProfile[i].self_ns;
+    }
+
+    pthread_mutex_unlock(&sProfileLock);
+}
+
+_PRIVATE int compare_slots(const void *a, const void *b)
+{
+    const unsigned long long x = ((const ProfileSlot *)a)->self_ns, y = ((const ProfileSlot *)b)->self_ns;
+    return (x < y) - (x > y);
+}
+
+_PRIVATE void profile_report(void)
+{
+    qsort(sProfile, PROFILE_SLOTS, sizeof(ProfileSlot), compare_slots);
+
+    u32 count = 0;
+    unsigned long long total_ns = 0;
+    while (count < PROFILE_SLOTS && sProfile[count].fn)
+        total_ns += sProfile[count++].self_ns;
+
+    // Asking addr2line for the names, in the order of the table.
+    char exe[512], cmd[16384];
+    const ssize_t len = readlink("/proc/self/exe", exe, sizeof(exe) - 1);
+    exe[len > 0 ? len : 0] = '\0';
+
+    int pos = snprintf(cmd, sizeof(cmd), "addr2line -f -e '%s'", exe);
+    for (u32 i = 0; i < count && pos < (int)sizeof(cmd) - 24; i++)
+        pos += snprintf(cmd + pos, sizeof(cmd) - pos, " %p", sProfile[i].fn);
+
+    FILE *const names = popen(cmd, "r");
+    printf("profile     %.2fs of self time in the core, hooks included, by function:\n", total_ns * 1e-9);
+
+    char name[256], location[1024];
+    for (u32 i = 0; i < count; i++)
+    {
+        if (!names || !fgets(name, sizeof(name), names) || !fgets(location, sizeof(location), names))
+            snprintf(name, sizeof(name), "%p\n", sProfile[i].fn);
+
+        name[strcspn(name, "\n")] = '\0';
+        printf("  %-28s %6.2f%% %10.3fs %12llu calls %8.1f ns/call\n", name, 100.0 * sProfile[i].self_ns / total_ns,
+               sProfile[i].self_ns * 1e-9, sProfile[i].calls, (double)sProfile[i].self_ns / sProfile[i].calls);
+    }
+
+    if (names)
+        pclose(names);
+}
+#else
+_PRIVATE void profile_flush(void) {}
+_PRIVATE void profile_report(void) {}
+#endif
+
+// CPU time spent stepping the games by the last run of the pool.
+_PRIVATE double step_sec(void)
+{
+    unsigned long long ns = 0;
+    for (u32 i = 0; i < sWorkerCount; i++)
+        ns += sWorkers[i].step_ns;
+
+    return ns * 1e-9;
+}
+
+_PRIVATE void *worker_main(void *arg)
+{
+    Worker *const self = arg;
+
+    u32 index;
+    if (!sBatched)
+    {
+        while (next_game(self, &index))
+        {
+            play_game(self, index);
+            self->games_played++;
+        }
+    }
+    else
+    {
+        u32 seeds[BATCH_LANES], count;
+        GameResult *results[BATCH_LANES];
+        do
+        {
+            for (count = 0; count < BATCH_LANES && next_game(self, &index); count++)
+            {
+                seeds[count] = sSeed + index;
+                results[count] = &sResults[index];
+            }
+
+            if (count > 0)
+                self->step_ns += batch_play(sSpeed, seeds, count, results);
+
+            self->games_played += count;
+        } while (count == BATCH_LANES);
+    }
+
+    profile_flush();
+    return NULL;
+}
+
+// Plays the games on sWorkerCount threads, starting from an even split of the games.
+_PRIVATE void run_pool(u32 games, double *out_wall_sec, double *out_cpu_sec)
+{
+    for (u32 i = 0; i < sWorkerCount; i++)
+    {
+        sWorkers[i].next = (u32)((unsigned long long)games * i / sWorkerCount);
+        sWorkers[i].end = (u32)((unsigned long long)games * (i + 1) / sWorkerCount);
+        sWorkers[i].games_played = sWorkers[i].games_stolen = 0;
+        sWorkers[i].step_ns = 0;
+        sWorkers[i].path_stats = (PM_PathStats){0};
+    }
+
+    const double start = now_sec(), start_cpu = cpu_sec();
+    for (u32 i = 0; i < sWorkerCount; i++)
+        pthread_create(&sWorkers[i].thread, NULL, worker_main, &sWorkers[i]);
+
+    for (u32 i = 0; i < sWorkerCount; i++)
+        pthread_join(sWorkers[i].thread, NULL);
+
+    *out_wall_sec = now_sec() - start;
+    *out_cpu_sec = cpu_sec() - start_cpu;
+}
+
+// REPORT
+
+_PRIVATE int compare_u16(const void *a, const void *b)
+{
+    return (int)*(const u16 *)a - (int)*(const u16 *)b;
+}
+
+_PRIVATE unsigned long long total_ticks(const GameResult *const results, u32 games)
+{
+    unsigned long long ticks = 0;
+    for (u32 i = 0; i < games; i++)
+        ticks += results[i].ticks;
+
+    return ticks;
+}
+
+_PRIVATE void report(u32 games, double wall_sec, double cpu)
+{
+    u16 *const scores = malloc(games * sizeof(u16));
+    unsigned long long ticks = 0, score_sum = 0, pills_sum = 0, contacts = 0;
+    u32 victories = 0;
+    for (u32 i = 0; i < games; i++)
+    {
+        scores[i] = sResults[i].score;
+        ticks += sResults[i].ticks;
+        score_sum += sResults[i].score;
+        pills_sum += sResults[i].pills_eaten;
+        contacts += sResults[i].ghost_contacts;
+        victories += sResults[i].is_victory;
+    }
+
+    qsort(scores, games, sizeof(u16), compare_u16);
+
+    printf("games       %u on %u threads, %.2fs wall, %.2fs cpu\n", games, sWorkerCount, wall_sec, cpu);
+    printf("throughput  %.0f games/s, %.0f ticks/s, %.0f ns/tick of cpu\n", games / wall_sec, ticks / wall_sec,
+           cpu * 1e9 / ticks);
+    printf("victories   %.1f%%, %.0f ticks per game on average\n", 100.0 * victories / games, (double)ticks / games);
+    printf("pills       %.1f eaten on average\n", (double)pills_sum / games);
+    printf("contacts    %.2f per game\n", (double)contacts / games);
+    printf("score       mean %.1f, min %u, p10 %u, p50 %u, p90 %u, max %u\n", (double)score_sum / games, scores[0],
+           scores[games / 10], scores[games / 2], scores[games * 9 / 10], scores[games - 1]);
+
+    // Histogram of the scores, in 10 buckets between the min and the max.
+    const u32 lo = scores[0], width = (scores[games - 1] - lo) / 10 + 1;
+    u32 buckets[10] = {0};
+    for (u32 i = 0; i < games; i++)
+        buckets[(scores[i] - lo) / width]++;
+
+    for (u32 b = 0; b < 10; b++)
+    {
+        printf("  %5u-%-5u %6u ", lo + b * width, lo + (b + 1) * width - 1, buckets[b]);
+        for (u32 n = 0; n < buckets[b] * 50 / games; n++)
+            putchar('#');
+        putchar('\n');
+    }
+
+    PM_PathStats path = {0};
+    u32 stolen = 0;
+    for (u32 i = 0; i < sWorkerCount; i++)
+    {
+        path.searches += sWorkers[i].path_stats.searches;
+        path.restarts += sWorkers[i].path_stats.restarts;
+        path.expansions += sWorkers[i].path_stats.expansions;
+        stolen += sWorkers[i].games_stolen;
+    }
+
+    printf("pathfinding %.1f searches, %.1f restarts, %.1f expansions per game\n", (double)path.searches / games,
+           (double)path.restarts / games, (double)path.expansions / games);
+    printf("pool        %u games stolen\n", stolen);
+
+    if (sReplayed)
+    {
+        unsigned long long bytes = 0;
+        u32 truncated = 0, differ = 0;
+        for (u32 i = 0; i < games; i++)
+        {
+            bytes += sResults[i].replay_bytes;
+            truncated += sResults[i].replay_truncated;
+            differ += sResults[i].replay_differs;
+        }
+
+        printf("replays     %.0f bytes per minute of play, %u truncated, %u of %u played back differ\n",
+               bytes * 60.0 * PM_TICKS_PER_SEC / ticks, truncated, differ, games - truncated);
+    }
+
+    profile_report();
+    free(scores);
+}
+
+// MAIN
+
+int main(int argc, char **argv)
+{
+    u32 games = 10000;
+    long threads = sysconf(_SC_NPROCESSORS_ONLN);
+    sBot = greedy_bot;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:j:b:s:S:BR")) != -1)
+    {
+        switch (opt)
+        {
+        case 'n':
+            games = strtoul(optarg, NULL, 0);
+            break;
+        case 'j':
+            threads = strtol(optarg, NULL, 0);
+            break;
+        case 'b':
+            if (!strcmp(optarg, "greedy"))
+                sBot = greedy_bot;
+            else if (!strcmp(optarg, "random"))
+                sBot = random_bot;
+            else
+                goto usage;
+            break;
+        case 's':
+            if (!strcmp(optarg, "fast"))
+                sSpeed = PM_SPEED_FAST;
+            else if (!strcmp(optarg, "normal"))
+                sSpeed = PM_SPEED_NORMAL;
+            else if (!strcmp(optarg, "slow"))
+                sSpeed = PM_SPEED_SLOW;
+            else
+                goto usage;
+            break;
+        case 'S':
+            sSeed = strtoul(optarg, NULL, 0);
+            break;
+        case 'B':
+            sBatched = true;
+            break;
+        case 'R':
+            sReplayed = true;
+            break;
+        default:
+            goto usage;
+        }
+    }
+
+    // The lockstep games are not played through the core, hence they can't be recorded.
+    if (games == 0 || threads < 1 || (sBatched && sReplayed))
+        goto usage;
+
+    // The lockstep simulator only knows the random bot.
+    if (sBatched)
+        sBot = random_bot;
+
+    sWorkerCount = (u32)(threads < MAX_WORKERS ? threads : MAX_WORKERS);
+    sResults = calloc(games, sizeof(GameResult));
+    if (!sResults)
+        return 1;
+
+    for (u32 i = 0; i < sWorkerCount; i++)
+        pthread_mutex_init(&sWorkers[i].lock, NULL);
+
+    double wall = 0, cpu = 0;
+    if (sBatched)
+    {
+        // The reference run, one game at a time, through the core.
+        sBatched = false;
+        run_pool(games, &wall, &cpu);
+        report(games, wall, cpu);
+
+        GameResult *const reference = sResults;
+        sResults = calloc(games, sizeof(GameResult));
+        if (!sResults)
+            return 1;
+
+        const double reference_step = step_sec();
+        const unsigned long long reference_ticks = total_ticks(reference, games);
+        sBatched = true;
+        run_pool(games, &wall, &cpu);
+        printf("\nghost-free games, in lockstep:\n");
+        report(games, wall, cpu);
+
+        // The ghost-free games last longer, hence they're compared per tick. The setup of the games
+        // is left out, as it's the same.
+        const unsigned long long ticks = total_ticks(sResults, games);
+        printf("lockstep    %.0f ticks/s per core one game at a time with the ghosts, %.0f by %u ghost-free games "
+               "at a time (%.1fx)\n",
+               reference_ticks / reference_step, ticks / step_sec(), BATCH_LANES,
+               (ticks / step_sec()) / (reference_ticks / reference_step));
+        free(reference);
+    }
+    else
+    {
+        run_pool(games, &wall, &cpu);
+        report(games, wall, cpu);
+    }
+
+    // A replay that doesn't play the game recorded fails the run.
+    u32 replays_differ = 0;
+    for (u32 i = 0; i < games; i++)
+        replays_differ += sResults[i].replay_differs;
+
+    free(sResults);
+    return replays_differ ? 1 : 0;
+
+usage:
+    fprintf(stderr,
+            "usage: %s [-n games] [-j threads] [-b greedy|random] [-s fast|normal|slow] [-S seed] [-B] [-R]\n",
+            argv[0]);
+    return 2;
+}
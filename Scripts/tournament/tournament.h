@@ -0,0 +1,46 @@
+#ifndef __TOURNAMENT_H
+#define __TOURNAMENT_H
+
+#include "pacman_core.h"
+
+#include <time.h>
+
+/// @brief Games stepped in lockstep by batch_play, one per SIMD lane.
+#ifndef BATCH_LANES
+#define BATCH_LANES 8
+#endif
+
+typedef struct
+{
+    u16 score;
+    u16 pills_eaten;
+    u32 ticks;
+    u16 ghost_contacts; // Times a ghost reached PacMan's cell, or collided with him
+    bool is_victory;
+    u16 replay_bytes;      // With -R, bytes of the recording of the game
+    bool replay_truncated; // The recording ran out of space, hence it wasn't compared
+    bool replay_differs;   // Played back, the recording didn't end in the same state
+} GameResult;
+
+/// @brief Returns the seed of the random bot for the game played with the given seed.
+static inline u32 bot_seed(u32 game_seed)
+{
+    return game_seed * 2654435761u | 1;
+}
+
+/// @brief CPU time of the calling thread, in ns.
+static inline unsigned long long thread_cpu_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/// @brief Plays up to BATCH_LANES games of the random bot in lockstep, with the pill state, the
+///        positions and the timers of the games stored structure-of-arrays, and updated with SIMD.
+/// @note Only ghost-free games are played: the ghosts, their collisions with PacMan and the lives are not
+///       simulated, hence the games are not the ones pacman_core.c plays with the same seeds.
+/// @return CPU time spent stepping the games, in ns, i.e. without setting them up.
+unsigned long long batch_play(PM_Speed speed, const u32 *seeds, u32 count, GameResult *const results[]);
+
+#endif